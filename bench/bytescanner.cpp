@@ -0,0 +1,289 @@
+#include "../includes/utils/ByteScanner.hpp"
+
+/*
+ * bytescanner.cpp
+ *
+ * Microbenchmark of the request head scan: the per-byte loops the parser used
+ * before ByteScanner (m_isCRLF / m_isCharInSet) against the ByteScanner
+ * kernels, on an 817-byte head with 15 browser headers. Both scans find the
+ * same token boundaries; the head is scanned 'iterations' times by each, in
+ * several rounds, and the fastest round is kept.
+ *
+ * ByteScanner.cpp is built three times (see 'make bench'): with every kernel,
+ * without AVX2 and without SSE2. Each copy is renamed so the three can be
+ * linked together and timed on the same CPU. This file and the three copies
+ * are all built with -O2, so the former loops are timed with the same
+ * optimisation as the kernels.
+ *
+ * Usage: ./bench/bytescanner [iterations]
+ */
+
+#define ByteScanner ByteScannerSse2
+#undef BYTESCANNER_HPP
+#include "../includes/utils/ByteScanner.hpp"
+#undef ByteScanner
+
+#define ByteScanner ByteScannerScalar
+#undef BYTESCANNER_HPP
+#include "../includes/utils/ByteScanner.hpp"
+#undef ByteScanner
+
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#define BENCH_ITERATIONS 200000
+#define BENCH_ROUNDS 5
+#define BENCH_MAX_TOKENS 64 // Method, URI, version and 15 name/value pairs
+
+// Offsets of the ends of the tokens of a head
+struct HeadTokens
+{
+    size_t ends[ BENCH_MAX_TOKENS ];
+    size_t count;
+};
+
+static const char *s_head =
+    "GET /pages/home.html?lang=en&theme=dark HTTP/1.1\r\n"
+    "Host: localhost:8080\r\n"
+    "Connection: keep-alive\r\n"
+    "Cache-Control: max-age=0\r\n"
+    "sec-ch-ua: \"Chromium\";v=\"124\", \"Google Chrome\";v=\"124\"\r\n"
+    "sec-ch-ua-mobile: ?0\r\n"
+    "sec-ch-ua-platform: \"Linux\"\r\n"
+    "Upgrade-Insecure-Requests: 1\r\n"
+    "User-Agent: Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, "
+    "like Gecko) Chrome/124.0.0.0 Safari/537.36\r\n"
+    "Accept: text/html,application/xhtml+xml,application/xml;q=0.9,image/avif,"
+    "image/webp,image/apng,*/*;q=0.8\r\n"
+    "Sec-Fetch-Site: same-origin\r\n"
+    "Sec-Fetch-Mode: navigate\r\n"
+    "Referer: http://localhost:8080/index.html\r\n"
+    "Accept-Encoding: gzip, deflate, br, zstd\r\n"
+    "Accept-Language: en-GB,en-US;q=0.9,en;q=0.8,fr;q=0.7\r\n"
+    "Cookie: session_id=7f3a9c2e41b84d0f9a6e5c3b2d1f0e8a; theme=dark; "
+    "last_visit=1718099999; consent=analytics%2Cpreferences; "
+    "tz=Europe/Brussels\r\n"
+    "\r\n";
+
+/*
+ * Former scan: one byte at a time, with the helpers of the old parser
+ */
+
+static bool isCRLF(std::vector<char>::const_iterator it)
+{
+    return *it == '\r' && *(it + 1) == '\n';
+}
+
+static bool isCharInSet(std::vector<char>::const_iterator it,
+                        const std::string &set)
+{
+    return set.find(*it) != std::string::npos;
+}
+
+// Returns false on a malformed head
+static bool legacyScanHead(const std::vector<char> &buffer, HeadTokens &tokens)
+{
+    std::vector<char>::const_iterator begin = buffer.begin();
+    std::vector<char>::const_iterator it = begin;
+    tokens.count = 0;
+
+    // Method and URI end at a space
+    for (int i = 0; i < 2; i++)
+    {
+        while (it != buffer.end() && *it != ' ')
+            ++it;
+        tokens.ends[ tokens.count++ ] = it - begin;
+        ++it;
+    }
+
+    // HTTP version ends at CRLF
+    while (it != buffer.end() && !isCRLF(it))
+    {
+        if (isCharInSet(it, "\r\n"))
+            return false;
+        ++it;
+    }
+    tokens.ends[ tokens.count++ ] = it - begin;
+    it += 2;
+
+    // Header fields, until the empty line
+    while (it != buffer.end() && !isCRLF(it))
+    {
+        if (isCharInSet(it, "\r\n"))
+            return false;
+        while (it != buffer.end() && *it != ':')
+            ++it;
+        if (it == buffer.end() || tokens.count + 2 > BENCH_MAX_TOKENS)
+            return false;
+        tokens.ends[ tokens.count++ ] = it - begin;
+        ++it;
+        if (it != buffer.end() && *it == ' ')
+            ++it;
+        while (it != buffer.end() && !isCRLF(it))
+            ++it;
+        tokens.ends[ tokens.count++ ] = it - begin;
+        it += 2;
+    }
+    return it != buffer.end();
+}
+
+/*
+ * Current scan: each token is skipped with one kernel call, the byte it stops
+ * at is checked the way RequestParser::m_scanHeadChunk does
+ */
+
+template <class Scanner>
+static bool scanHead(const std::vector<char> &buffer, HeadTokens &tokens)
+{
+    const char *data = buffer.data();
+    size_t size = buffer.size();
+    size_t offset = 0;
+    tokens.count = 0;
+
+    offset += Scanner::findNonToken(data + offset, size - offset);
+    if (offset >= size || data[ offset ] != ' ')
+        return false;
+    tokens.ends[ tokens.count++ ] = offset++;
+
+    offset += Scanner::findDelimiter(data + offset, size - offset, ' ');
+    if (offset >= size || data[ offset ] != ' ')
+        return false;
+    tokens.ends[ tokens.count++ ] = offset++;
+
+    offset += Scanner::findDelimiter(data + offset, size - offset, '\r');
+    if (offset + 1 >= size || data[ offset ] != '\r' ||
+        data[ offset + 1 ] != '\n')
+        return false;
+    tokens.ends[ tokens.count++ ] = offset;
+    offset += 2;
+
+    while (offset + 1 < size && data[ offset ] != '\r')
+    {
+        offset += Scanner::findNonToken(data + offset, size - offset);
+        if (offset >= size || data[ offset ] != ':' ||
+            tokens.count + 2 > BENCH_MAX_TOKENS)
+            return false;
+        tokens.ends[ tokens.count++ ] = offset++;
+        if (offset < size && data[ offset ] == ' ')
+            offset++;
+
+        // HTAB is the only control character allowed in a value
+        offset += Scanner::findDelimiter(data + offset, size - offset, '\r');
+        while (offset < size && data[ offset ] == '\t')
+        {
+            offset++;
+            offset +=
+                Scanner::findDelimiter(data + offset, size - offset, '\r');
+        }
+        if (offset + 1 >= size || data[ offset ] != '\r' ||
+            data[ offset + 1 ] != '\n')
+            return false;
+        tokens.ends[ tokens.count++ ] = offset;
+        offset += 2;
+    }
+    return offset + 1 < size && data[ offset + 1 ] == '\n';
+}
+
+/*
+ * Timing
+ */
+
+typedef bool (*ScanFunction)(const std::vector<char> &, HeadTokens &);
+
+static double now()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+// Nanoseconds per head, in the fastest round
+static double timeScan(ScanFunction scan, const std::vector<char> &buffer,
+                       long iterations)
+{
+    HeadTokens tokens;
+    volatile size_t sink = 0;
+    double fastest = 0;
+    for (int round = 0; round < BENCH_ROUNDS; round++)
+    {
+        double start = now();
+        for (long i = 0; i < iterations; i++)
+        {
+            scan(buffer, tokens);
+            sink += tokens.ends[ tokens.count - 1 ];
+        }
+        double elapsed = now() - start;
+        if (round == 0 || elapsed < fastest)
+            fastest = elapsed;
+    }
+    (void)sink;
+    return fastest * 1e9 / iterations;
+}
+
+static bool sameTokens(const HeadTokens &left, const HeadTokens &right)
+{
+    if (left.count != right.count)
+        return false;
+    for (size_t i = 0; i < left.count; i++)
+        if (left.ends[ i ] != right.ends[ i ])
+            return false;
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    long iterations = argc > 1 ? std::atol(argv[ 1 ]) : BENCH_ITERATIONS;
+    if (iterations <= 0)
+    {
+        std::cerr << "usage: " << argv[ 0 ] << " [iterations]" << std::endl;
+        return 1;
+    }
+
+    std::string head(s_head);
+    std::vector<char> buffer(head.begin(), head.end());
+
+    ScanFunction scans[] = {scanHead<ByteScanner>, scanHead<ByteScannerSse2>,
+                            scanHead<ByteScannerScalar>};
+    const char *names[] = {ByteScanner::getKernelName(),
+                           ByteScannerSse2::getKernelName(),
+                           ByteScannerScalar::getKernelName()};
+
+    // The kernels must find the tokens the former loops find
+    HeadTokens expected;
+    if (!legacyScanHead(buffer, expected))
+    {
+        std::cerr << "former scan rejected the head" << std::endl;
+        return 1;
+    }
+    for (size_t i = 0; i < 3; i++)
+    {
+        HeadTokens tokens;
+        if (!scans[ i ](buffer, tokens) || !sameTokens(tokens, expected))
+        {
+            std::cerr << names[ i ] << ": tokens differ" << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << "head: " << buffer.size() << " bytes, "
+              << (expected.count - 3) / 2 << " headers, " << iterations
+              << " iterations, fastest of " << BENCH_ROUNDS
+              << " rounds, all at -O2" << std::endl;
+    double legacy = timeScan(legacyScanHead, buffer, iterations);
+    std::cout << std::fixed << std::setprecision(1) << std::setw(8)
+              << "per-byte" << ": " << std::setw(8) << legacy << " ns/head"
+              << std::endl;
+    for (size_t i = 0; i < 3; i++)
+    {
+        double elapsed = timeScan(scans[ i ], buffer, iterations);
+        std::cout << std::setw(8) << names[ i ] << ": " << std::setw(8)
+                  << elapsed << " ns/head  x" << legacy / elapsed << std::endl;
+    }
+    return 0;
+}
+
+// Path: bench/bytescanner.cpp
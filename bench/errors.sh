@@ -0,0 +1,61 @@
+#!/bin/bash
+#
+# errors.sh
+#
+# Server CPU time per rejected request (see 'make bench-errors'). webserv is
+# run with bench/bench.conf, and its user and system time is read from
+# /proc/<pid>/stat before and after each load of bench/loadgen:
+# - route: 20000 DELETE requests refused with 405, 100 pipelined per batch on
+#   persistent connections;
+# - head: 20000 malformed heads answered with 400, one connection per
+#   request, from 4 clients.
+#
+# Each load is run three times; the median is printed with the requests per
+# second seen by the load generator. Accept and close dominate the head load,
+# so it is the noisier one.
+#
+# Usage: [WEBSERV=path/to/webserv] bench/errors.sh
+
+CONFIG=bench/bench.conf
+WEBSERV=${WEBSERV:-./webserv}
+RUNS=3
+
+# A failed run fails the script
+set -o pipefail
+
+# Prints the user plus system time of process $1, in clock ticks
+cpu_ticks() {
+    awk '{ print $14 + $15 }' /proc/$1/stat
+}
+
+# Prints "<microseconds of CPU per request> <requests per second>"
+measure() {
+    local count=$2
+    $WEBSERV $CONFIG >/dev/null 2>&1 &
+    local pid=$!
+    sleep 0.5
+    if [ ! -e /proc/$pid/stat ]; then
+        echo "errors: the server did not start" >&2
+        return 1
+    fi
+    local before=$(cpu_ticks $pid)
+    local output
+    output=$(./bench/loadgen "$@")
+    local status=$?
+    local after=$(cpu_ticks $pid)
+    kill -INT $pid
+    wait $pid
+    [ $status -eq 0 ] || return 1
+    echo "$output" | awk -v ticks=$((after - before)) \
+        -v hertz=$(getconf CLK_TCK) -v count=$count \
+        '{ printf "%.1f %s\n", ticks * 1e6 / hertz / count, $4 }'
+}
+
+for load in "route 20000" "head 20000 4"; do
+    for run in $(seq $RUNS); do
+        measure $load || exit 1
+    done | sort -n | awk -v load="${load%% *}" -v median=$(((RUNS + 1) / 2)) '
+        NR == median {
+            printf "%6s: %6.1f us cpu/request, %s requests/s\n", load, $1, $2
+        }' || exit 1
+done
@@ -0,0 +1,315 @@
+#include <arpa/inet.h>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <netinet/in.h>
+#include <pthread.h>
+#include <string>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/*
+ * loadgen.cpp
+ *
+ * Load generator for the benchmarks that need a running server (see
+ * 'make malloc-check' and 'make bench-errors'). It talks to 127.0.0.1:8080
+ * and prints the number of requests answered per second.
+ *
+ * Modes:
+ * - get: 'count' GET requests for 'path', one after the other on a single
+ *   persistent connection; each response is read in full before the next
+ *   request is sent.
+ * - route: 'count' DELETE requests the route refuses with 405, on persistent
+ *   connections of 8 batches of 100 pipelined requests.
+ * - head: 'count' requests with a malformed head, answered with 400, one
+ *   connection per request, from 'clients' threads at once.
+ *
+ * The requests of route and head carry 10 browser-like header fields, 6 of
+ * them unknown to the server.
+ *
+ * Usage: ./bench/loadgen get count [path]
+ *        ./bench/loadgen route count
+ *        ./bench/loadgen head count [clients]
+ */
+
+#define LOADGEN_PORT 8080
+#define LOADGEN_BUFFER_SIZE 65536
+#define LOADGEN_BATCH 100            // Pipelined requests per write
+#define LOADGEN_BATCHES_PER_CONNECTION 8
+#define LOADGEN_MAX_CLIENTS 64
+
+static const char *s_headers = "Host: localhost:8080\r\n"
+                               "User-Agent: loadgen/1.0\r\n"
+                               "Accept: */*\r\n";
+
+static const char *s_browser_headers =
+    "Host: localhost:8080\r\n"
+    "User-Agent: Mozilla/5.0 (X11; Linux x86_64)\r\n"
+    "Accept: text/html\r\n"
+    "Accept-Language: en-US\r\n"
+    "Sec-CH-UA: \"x\"\r\n"
+    "Sec-CH-UA-Mobile: ?0\r\n"
+    "Sec-CH-UA-Platform: \"Linux\"\r\n"
+    "X-Request-Id: 1234\r\n"
+    "Sec-Fetch-Site: none\r\n"
+    "DNT: 1\r\n";
+
+static double now()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+static int connectToServer()
+{
+    int socket_descriptor = socket(AF_INET, SOCK_STREAM, 0);
+    if (socket_descriptor == -1)
+        return -1;
+    struct sockaddr_in address;
+    std::memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons(LOADGEN_PORT);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (connect(socket_descriptor, (struct sockaddr *)&address,
+                sizeof(address)) == -1)
+    {
+        close(socket_descriptor);
+        return -1;
+    }
+    return socket_descriptor;
+}
+
+static bool sendAll(int socket_descriptor, const std::string &data)
+{
+    size_t sent = 0;
+    while (sent < data.size())
+    {
+        ssize_t written = write(socket_descriptor, data.data() + sent,
+                                data.size() - sent);
+        if (written <= 0)
+            return false;
+        sent += written;
+    }
+    return true;
+}
+
+// Read one response, its head and its Content-Length bytes of body. Bytes
+// read past its end are kept in 'pending' for the next response.
+static bool readResponse(int socket_descriptor, std::string &pending,
+                         std::string &status)
+{
+    char buffer[ LOADGEN_BUFFER_SIZE ];
+    size_t head_end;
+    while ((head_end = pending.find("\r\n\r\n")) == std::string::npos)
+    {
+        ssize_t received = read(socket_descriptor, buffer, sizeof(buffer));
+        if (received <= 0)
+            return false;
+        pending.append(buffer, received);
+    }
+
+    // Field names are case-insensitive
+    std::string head = pending.substr(0, head_end);
+    for (size_t i = 0; i < head.size(); i++)
+        head[ i ] = std::tolower(head[ i ]);
+    size_t content_length = 0;
+    size_t field = head.find("\r\ncontent-length:");
+    if (field != std::string::npos)
+        content_length = std::strtoul(head.c_str() + field + 17, NULL, 10);
+
+    size_t response_size = head_end + 4 + content_length;
+    while (pending.size() < response_size)
+    {
+        ssize_t received = read(socket_descriptor, buffer, sizeof(buffer));
+        if (received <= 0)
+            return false;
+        pending.append(buffer, received);
+    }
+    status = pending.substr(0, pending.find("\r\n"));
+    pending.erase(0, response_size);
+    return true;
+}
+
+static bool runGet(long count, const std::string &path)
+{
+    int socket_descriptor = connectToServer();
+    if (socket_descriptor == -1)
+    {
+        std::cerr << "loadgen: cannot connect to port " << LOADGEN_PORT
+                  << std::endl;
+        return false;
+    }
+    std::string request =
+        "GET " + path + " HTTP/1.1\r\n" + s_headers + "\r\n";
+    std::string pending;
+    std::string status;
+    for (long i = 0; i < count; i++)
+    {
+        if (!sendAll(socket_descriptor, request) ||
+            !readResponse(socket_descriptor, pending, status))
+        {
+            std::cerr << "loadgen: connection closed after " << i
+                      << " responses" << std::endl;
+            close(socket_descriptor);
+            return false;
+        }
+        if (status.compare(0, 12, "HTTP/1.1 200") != 0)
+        {
+            std::cerr << "loadgen: " << status << std::endl;
+            close(socket_descriptor);
+            return false;
+        }
+    }
+    close(socket_descriptor);
+    return true;
+}
+
+static bool runRoute(long count)
+{
+    std::string request =
+        std::string("DELETE / HTTP/1.1\r\n") + s_browser_headers + "\r\n";
+    std::string batch;
+    for (int i = 0; i < LOADGEN_BATCH; i++)
+        batch += request;
+
+    std::string pending;
+    std::string status;
+    for (long done = 0; done < count;)
+    {
+        int socket_descriptor = connectToServer();
+        if (socket_descriptor == -1)
+        {
+            std::cerr << "loadgen: cannot connect to port " << LOADGEN_PORT
+                      << std::endl;
+            return false;
+        }
+        pending.clear();
+        for (int batches = 0;
+             batches < LOADGEN_BATCHES_PER_CONNECTION && done < count;
+             batches++)
+        {
+            if (!sendAll(socket_descriptor, batch))
+                break;
+            for (int i = 0; i < LOADGEN_BATCH; i++, done++)
+            {
+                if (!readResponse(socket_descriptor, pending, status) ||
+                    status.compare(0, 12, "HTTP/1.1 405") != 0)
+                {
+                    std::cerr << "loadgen: expected 405, got '" << status
+                              << "'" << std::endl;
+                    close(socket_descriptor);
+                    return false;
+                }
+            }
+        }
+        close(socket_descriptor);
+    }
+    return true;
+}
+
+// One client of the head mode
+struct HeadClient
+{
+    pthread_t thread;
+    long count;
+    bool ok;
+};
+
+static void *runHeadClient(void *argument)
+{
+    HeadClient &client = *static_cast<HeadClient *>(argument);
+    std::string request = std::string("GET / HTTP/1.1\r\n") +
+                          s_browser_headers + "Bad Header\r\n\r\n";
+    char buffer[ LOADGEN_BUFFER_SIZE ];
+    std::string response;
+    client.ok = false;
+    for (long i = 0; i < client.count; i++)
+    {
+        int socket_descriptor = connectToServer();
+        if (socket_descriptor == -1 || !sendAll(socket_descriptor, request))
+        {
+            std::cerr << "loadgen: cannot send to port " << LOADGEN_PORT
+                      << std::endl;
+            return NULL;
+        }
+
+        // The server closes the connection after a malformed head
+        response.clear();
+        ssize_t received;
+        while ((received = read(socket_descriptor, buffer, sizeof(buffer))) >
+               0)
+            response.append(buffer, received);
+        close(socket_descriptor);
+        if (response.compare(0, 12, "HTTP/1.1 400") != 0)
+        {
+            std::cerr << "loadgen: expected 400, got '"
+                      << response.substr(0, response.find("\r\n")) << "'"
+                      << std::endl;
+            return NULL;
+        }
+    }
+    client.ok = true;
+    return NULL;
+}
+
+// The count is shared out between the clients
+static bool runHead(long count, int clients)
+{
+    HeadClient head_clients[ LOADGEN_MAX_CLIENTS ];
+    for (int i = 0; i < clients; i++)
+    {
+        head_clients[ i ].count = count / clients + (i < count % clients);
+        pthread_create(&head_clients[ i ].thread, NULL, runHeadClient,
+                       &head_clients[ i ]);
+    }
+    bool ok = true;
+    for (int i = 0; i < clients; i++)
+    {
+        pthread_join(head_clients[ i ].thread, NULL);
+        ok = ok && head_clients[ i ].ok;
+    }
+    return ok;
+}
+
+static int usage(const char *name)
+{
+    std::cerr << "usage: " << name << " get count [path]" << std::endl
+              << "       " << name << " route count" << std::endl
+              << "       " << name << " head count [clients]" << std::endl;
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    long count = argc > 2 ? std::atol(argv[ 2 ]) : 0;
+    if (argc < 3 || count <= 0)
+        return usage(argv[ 0 ]);
+    std::string mode(argv[ 1 ]);
+
+    double start = now();
+    bool ok;
+    if (mode == "get")
+        ok = runGet(count, argc > 3 ? argv[ 3 ] : "/pages/home.html");
+    else if (mode == "route")
+        ok = runRoute(count);
+    else if (mode == "head")
+    {
+        int clients = argc > 3 ? std::atoi(argv[ 3 ]) : 1;
+        if (clients <= 0 || clients > LOADGEN_MAX_CLIENTS)
+            return usage(argv[ 0 ]);
+        ok = runHead(count, clients);
+    }
+    else
+        return usage(argv[ 0 ]);
+    if (!ok)
+        return 1;
+    std::cout << argv[ 1 ] << ": " << count << " requests, "
+              << static_cast<long>(count / (now() - start)) << " requests/s"
+              << std::endl;
+    return 0;
+}
+
+// Path: bench/loadgen.cpp
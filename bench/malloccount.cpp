@@ -0,0 +1,46 @@
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+
+/*
+ * malloccount.cpp
+ *
+ * Counts the calls to malloc() of a process. Built as a shared object and
+ * loaded with LD_PRELOAD, it forwards every call to the C library and prints
+ * the count on stderr when the process exits:
+ *
+ * mallocs: <pid> <count>
+ *
+ * operator new goes through malloc(), so the count covers the containers and
+ * strings of the server as well. See bench/mallocs.sh.
+ *
+ * Usage: LD_PRELOAD=./bench/malloccount.so ./webserv bench/bench.conf
+ */
+
+extern "C" void *__libc_malloc(size_t size);
+
+static unsigned long s_count = 0;
+
+static void printCount()
+{
+    char line[ 64 ];
+    int length = std::snprintf(line, sizeof(line), "mallocs: %d %lu\n",
+                               static_cast<int>(getpid()), s_count);
+    if (length > 0 && write(STDERR_FILENO, line, length) == -1)
+        return;
+}
+
+// Registered before main(); the C library runs it at exit()
+__attribute__((constructor)) static void registerCount()
+{
+    std::atexit(printCount);
+}
+
+extern "C" void *malloc(size_t size)
+{
+    __sync_fetch_and_add(&s_count, 1);
+    return __libc_malloc(size);
+}
+
+// Path: bench/malloccount.cpp
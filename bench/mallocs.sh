@@ -0,0 +1,48 @@
+#!/bin/bash
+#
+# mallocs.sh
+#
+# Counts the mallocs webserv makes per request (see 'make malloc-check'). The
+# server is run twice under bench/malloccount.so, serving 100 and then 600
+# keep-alive GETs of the same page; the difference between the two counts,
+# divided by 500, leaves out the startup and shutdown allocations.
+#
+# Exits with 1 if a request costs more than 'limit' mallocs.
+#
+# Usage: bench/mallocs.sh limit [path]
+
+LIMIT=$1
+URI=${2:-/pages/home.html}
+CONFIG=bench/bench.conf
+OUTPUT=$(mktemp)
+trap 'rm -f $OUTPUT' EXIT
+
+if [ -z "$LIMIT" ]; then
+    echo "usage: $0 limit [path]" >&2
+    exit 1
+fi
+
+# Prints the malloc count of a server that answered $1 requests
+count_mallocs() {
+    LD_PRELOAD=./bench/malloccount.so ./webserv $CONFIG >/dev/null 2>$OUTPUT &
+    local pid=$!
+    sleep 0.5
+    ./bench/loadgen get $1 $URI >/dev/null
+    local status=$?
+    kill -INT $pid
+    wait $pid
+    [ $status -eq 0 ] || return 1
+    awk -v pid=$pid '$1 == "mallocs:" && $2 == pid { print $3 }' $OUTPUT
+}
+
+FIRST=$(count_mallocs 100) || exit 1
+SECOND=$(count_mallocs 600) || exit 1
+if [ -z "$FIRST" ] || [ -z "$SECOND" ]; then
+    echo "mallocs: no count, was the server stopped by a signal?" >&2
+    exit 1
+fi
+awk -v first=$FIRST -v second=$SECOND -v limit=$LIMIT 'BEGIN {
+    per_request = (second - first) / 500
+    printf "mallocs: %.1f per request (limit %d)\n", per_request, limit
+    exit per_request > limit
+}'
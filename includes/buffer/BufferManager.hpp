@@ -38,7 +38,11 @@ class BufferManager : public IBufferManager
 private:
     std::map<int, IBuffer *> m_buffers;
     size_t m_flush_threshold;
+    size_t m_write_budget; // Bytes sent per socket flush, 0 for no limit
     ISocket &m_socket;
+    IPollingService *m_polling_service; // Backend of the file transfers
+
+    SocketBuffer &m_getSocketBuffer(int socket_descriptor);
 
 public:
     // Constructor
@@ -50,10 +54,18 @@ public:
     // Push into a file buffer
     ssize_t pushFileBuffer(int file_descriptor, const std::vector<char> &data,
                            size_t flush_threshold = DEFAULT_FLUSH_THRESHOLD);
+    ssize_t pushFileBuffer(int file_descriptor, const char *data, size_t size,
+                           size_t flush_threshold = DEFAULT_FLUSH_THRESHOLD);
 
-    // Push into a socket buffer
+    // Push into a socket buffer; the bytes of a shared buffer are not
+    // copied, a file is sent from the page cache and closed once sent
     ssize_t pushSocketBuffer(int socket_descriptor,
                              const std::vector<char> &data);
+    ssize_t pushSocketBuffer(int socket_descriptor, const char *data,
+                             size_t size);
+    ssize_t pushSocketBuffer(int socket_descriptor, const SharedBuffer &data);
+    ssize_t pushSocketFile(int socket_descriptor, int file_descriptor,
+                           off_t offset, size_t size);
 
     // Flush the buffer for a specific descriptor
     ssize_t flushBuffer(int descriptor, bool blocking = false);
@@ -70,8 +82,22 @@ public:
     // Set the flush threshold
     void setFlushThreshold(size_t threshold);
 
+    // Set the number of bytes a socket flush sends at most
+    void setWriteBudget(size_t write_budget);
+
+    // Check if the last flush of a socket buffer stopped at the write budget,
+    // or if a file buffer has a flush due
+    bool isFlushPending(int descriptor) const;
+
+    // Check if a descriptor has data waiting to be flushed
+    bool hasBuffer(int descriptor) const;
+
     // Transfer the buffer from one descriptor to another
     void transferBuffer(int source_descriptor, int target_descriptor);
+
+    // Set the polling service that reads and writes the files of the
+    // buffers, if it can; NULL waits for the transfers in flight
+    void setPollingService(IPollingService *polling_service);
 };
 
 #endif // BUFFERMANAGER_HPP
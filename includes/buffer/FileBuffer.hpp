@@ -7,8 +7,13 @@
  * Holds buffers intended for file descriptors.
  * Requests a flush when the buffer reaches a certain threshold, by returning 1.
  *
+ * When the polling service does file transfers (io_uring), a non-blocking
+ * flush hands the buffered bytes to it and returns; they stay in a buffer of
+ * their own until the write completes, while new bytes are pushed behind
+ * them. The next flush collects the result.
  */
 
+#include "../core/IPollingService.hpp"
 #include "IBuffer.hpp"
 #include <cstring>
 #include <vector>
@@ -21,8 +26,16 @@ class FileBuffer : public IBuffer
 {
 private:
     std::vector<char> m_buffer;     // Buffer to hold data
+    std::vector<char> m_writing;    // Data of the write in flight
+    int m_writing_descriptor;       // Its descriptor, -1 for none
     const size_t m_flush_threshold; // Threshold at which to request a flush
     const size_t m_max_size;        // Maximum size of the buffer
+    IPollingService *m_polling_service; // Backend of the file transfers
+
+    ssize_t m_collectWrite();
+
+    FileBuffer(const FileBuffer &);
+    FileBuffer &operator=(const FileBuffer &);
 
 public:
     // Constructor with optional parameters
@@ -34,6 +47,7 @@ public:
 
     // Push data into the buffer
     ssize_t push(const std::vector<char> &data);
+    ssize_t push(const char *data, size_t size);
 
     // Flush the buffer to a file descriptor
     ssize_t flush(int file_descriptor, bool regardless_of_threshold = false);
@@ -41,8 +55,15 @@ public:
     // Peek at the buffer
     std::vector<char> peek() const;
 
+    // Check if a flush is due: a write is in flight or the threshold is
+    // reached; file writes are not budgeted
+    bool isFlushPending() const;
+
     // Set a (new) descriptor for the buffer
     void setDescriptor(int descriptor);
+
+    // Set the backend of the file transfers, NULL to write directly
+    void setPollingService(IPollingService *polling_service);
 };
 
 #endif // FILEBUFFER_HPP
@@ -15,6 +15,8 @@
 #include <unistd.h>
 #include <vector>
 
+class IPollingService;
+
 class IBuffer
 {
 public:
@@ -24,8 +26,16 @@ public:
     virtual ssize_t
     push(const std::vector<char> &) = 0; // Method to append a vector of
                                          // characters to the buffer
+    virtual ssize_t push(const char *,
+                         size_t) = 0; // Method to append an array of
+                                      // characters to the buffer
     virtual ssize_t flush(int, bool = false) = 0; // Method to flush the buffer
     virtual std::vector<char> peek() const = 0; // Method to peek at the buffer
+    virtual bool isFlushPending() const = 0; // Method to check if the last
+                                             // flush stopped at its budget
+    virtual void
+    setPollingService(IPollingService *) = 0; // Method to set the backend
+                                              // doing its file transfers
 };
 
 #endif // IBUFFER_HPP
@@ -4,6 +4,9 @@
 #include <sys/types.h>
 #include <vector>
 
+class SharedBuffer;
+class IPollingService;
+
 class IBufferManager
 {
 public:
@@ -12,13 +15,22 @@ public:
     // methods for managing buffers
     virtual ssize_t pushFileBuffer(int, const std::vector<char> &,
                                    size_t = 32500) = 0;
+    virtual ssize_t pushFileBuffer(int, const char *, size_t,
+                                   size_t = 32500) = 0;
     virtual ssize_t pushSocketBuffer(int, const std::vector<char> &) = 0;
+    virtual ssize_t pushSocketBuffer(int, const char *, size_t) = 0;
+    virtual ssize_t pushSocketBuffer(int, const SharedBuffer &) = 0;
+    virtual ssize_t pushSocketFile(int, int, off_t, size_t) = 0;
     virtual ssize_t flushBuffer(int, bool = false) = 0;
     virtual void flushBuffers() = 0;
     virtual void destroyBuffer(int) = 0;
     virtual std::vector<char> peekBuffer(int) const = 0;
     virtual void setFlushThreshold(size_t) = 0;
+    virtual void setWriteBudget(size_t) = 0;
+    virtual bool isFlushPending(int) const = 0;
+    virtual bool hasBuffer(int) const = 0;
     virtual void transferBuffer(int, int) = 0;
+    virtual void setPollingService(IPollingService *) = 0;
 };
 
 #endif // IBUFFERMANAGER_HPP
@@ -0,0 +1,50 @@
+#ifndef SHAREDBUFFER_HPP
+#define SHAREDBUFFER_HPP
+
+/*
+ * SharedBuffer.hpp
+ *
+ * Bytes that several owners hold without copying them: a response body is
+ * handed to the socket buffer this way. The buffer takes the storage of a
+ * vector by swapping it and frees it with its last copy.
+ *
+ * The count of copies is not atomic; a buffer belongs to the thread of its
+ * connection.
+ */
+
+#include <cstddef>
+#include <vector>
+
+class SharedBuffer
+{
+private:
+    struct Block
+    {
+        std::vector<char> data;
+        size_t references;
+    };
+
+    Block *m_block;
+
+    void m_release();
+
+public:
+    // Constructors
+    SharedBuffer();
+    explicit SharedBuffer(std::vector<char> &data);
+    SharedBuffer(const SharedBuffer &src);
+
+    // Destructor
+    ~SharedBuffer();
+
+    SharedBuffer &operator=(const SharedBuffer &src);
+
+    // The bytes; data() is NULL when there are none
+    const char *data() const;
+    size_t size() const;
+    bool empty() const;
+};
+
+#endif // SHAREDBUFFER_HPP
+
+// Path: includes/buffer/SharedBuffer.hpp
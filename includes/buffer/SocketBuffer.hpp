@@ -5,34 +5,98 @@
  * SocketBuffer.hpp
  *
  * Holds buffers intended for socket descriptors.
+ *
+ * The buffer is a queue of segments: bytes copied in (the response heads),
+ * body buffers shared with their owner and ranges of files. Consecutive
+ * bytes are sent with one writev, a file range with sendfile, so neither is
+ * copied again; a partial send only moves the offset of the first segment.
+ *
+ * A non-blocking flush sends at most 'write budget' bytes, so a large
+ * response does not keep the core cycle away from the other clients. When
+ * the socket took the whole budget, more data can probably be sent at once:
+ * the flush is marked as pending and the descriptor is re-armed for the next
+ * pass.
+ *
+ * When the polling service does file transfers (io_uring), a file range is
+ * not sent with sendfile, which blocks the core cycle while the kernel reads
+ * a cold file from disk. The flush reads the next piece of the range through
+ * the polling service instead, and returns; the completion makes the socket
+ * ready, and the next flush sends the piece like copied bytes.
  */
 
+#include "../core/IPollingService.hpp"
 #include "../network/ISocket.hpp"
 #include "IBuffer.hpp"
-#include <cstring>
+#include "SharedBuffer.hpp"
+#include <deque>
+#include <string>
 #include <vector>
 
+#define SOCKETBUFFER_IOV_MAX 64     // Segments sent by one writev at most
+#define SOCKETBUFFER_READ_SIZE 65536 // Bytes of a file read per transfer
+
 class SocketBuffer : public IBuffer
 {
 private:
-    std::vector<char> m_buffer; // Buffer to hold data
-    ISocket &m_socket;          // Socket object for sending data
+    // Bytes of the queue: the copied bytes, the shared buffer or the range
+    // of the file descriptor, which the segment closes once sent
+    struct Segment
+    {
+        std::string bytes;
+        SharedBuffer buffer;
+        int file_descriptor;
+        off_t offset; // Start of the bytes not sent yet
+        size_t size;  // Bytes not sent yet
+    };
+
+    std::deque<Segment> m_segments; // Segments not sent yet, in order
+    size_t m_size;                  // Bytes not sent yet
+    size_t m_write_budget;          // Bytes sent per flush, 0 for no limit
+    bool m_flush_pending;           // Last flush stopped at the budget
+    ISocket &m_socket;              // Socket object for sending data
+    IPollingService *m_polling_service; // Backend of the file transfers
+    std::string m_reading;              // Target of the file read in flight
+    int m_reading_owner; // Socket the read was submitted for, -1 for none
+
+    Segment &m_pushSegment(int file_descriptor, off_t offset, size_t size);
+    ssize_t m_send(int socket_descriptor, size_t budget, size_t &requested);
+    void m_consume(size_t size);
+    void m_popSegment();
+    const char *m_data(const Segment &segment) const;
+    bool m_submitRead(int socket_descriptor);
+    ssize_t m_collectRead();
+
+    SocketBuffer(const SocketBuffer &);
+    SocketBuffer &operator=(const SocketBuffer &);
 
 public:
     // Constructor
-    SocketBuffer(ISocket &socket);
+    SocketBuffer(ISocket &socket, size_t write_budget = 0);
 
     // Destructor
     ~SocketBuffer();
 
-    // Push data into the buffer
+    // Push a copy of data into the buffer
     ssize_t push(const std::vector<char> &data);
+    ssize_t push(const char *data, size_t size);
+
+    // Push a shared buffer, its bytes are not copied
+    ssize_t push(const SharedBuffer &buffer);
+
+    // Push a range of a file; the buffer closes the file descriptor
+    ssize_t pushFile(int file_descriptor, off_t offset, size_t size);
 
     // Send the buffer to a socket descriptor
     ssize_t flush(int socket_descriptor, bool blocking = false);
 
     // Peek at the buffer
     std::vector<char> peek() const;
+
+    // Check if the last flush stopped at the write budget
+    bool isFlushPending() const;
+
+    // Set the backend of the file transfers, NULL to use sendfile
+    void setPollingService(IPollingService *polling_service);
 };
 
 #endif // SOCKETBUFFER_HPP
@@ -20,6 +20,10 @@ private:
     bool m_is_regex;
     ConfigurationBlock *m_parent;
 
+    // The configured value of a directive, NULL if it was not configured
+    const std::string *m_findString(const std::string &key,
+                                    size_t index) const;
+
 public:
     ConfigurationBlock(ILogger &logger, const std::string name,
                        Defaults &defaults);
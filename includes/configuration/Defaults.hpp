@@ -11,6 +11,7 @@ private:
     std::map<const std::string, std::vector<std::string> >
         m_directive_parameters;
     std::map<const std::string, std::vector<std::string> > m_block_parameters;
+    std::vector<std::string> m_no_parameters; // Returned for unknown keys
 
 public:
     Defaults();
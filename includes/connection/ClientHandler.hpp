@@ -14,12 +14,16 @@
 #include "../network/ISocket.hpp"
 #include "IClientHandler.hpp"
 
+#define CLIENTHANDLER_READ_CHUNKS 8 // Chunks offered to one readv()
+
 class ClientHandler : public IClientHandler
 {
 private:
     const ISocket &m_socket; // Reference to the Socket instance
     int m_socket_descriptor; // Socket descriptor for client connection
     ILogger &m_logger;       // Reference to the error logger object
+    size_t m_read_budget;    // Bytes read per readiness, 0 for no limit
+    mutable bool m_read_pending; // Last read stopped at the budget
 
 public:
     // Constructor: Initializes the ClientHandler with an error logger and
@@ -32,8 +36,18 @@ public:
     // Setter method to set the socket descriptor
     void setSocketDescriptor(int socket_descriptor);
 
-    // Method to read a request from the client
-    const std::vector<char> readRequest() const;
+    // Setter method to bound the bytes read per readiness
+    void setReadBudget(size_t read_budget);
+
+    // Getter method for the read budget
+    size_t getReadBudget() const;
+
+    // Check if the last read stopped at the budget with data left
+    bool isReadPending() const;
+
+    // Method to read from the client into the request buffer; returns the
+    // number of bytes read, 0 at the end of the stream
+    size_t readRequest(RequestBuffer &buffer) const;
 
     // Method to send a response to the client as a vector of characters
     ssize_t sendResponse(const std::vector<char> &response) const;
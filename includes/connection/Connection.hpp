@@ -9,14 +9,19 @@
  * address, as well as pointers to the request and response objects. Its
  * lifetime is tied to the active connection with the client.
  *
+ * The request and response allocate their maps from the arena of the
+ * connection, which is reset after each request.
+ *
  * It is owned by the ConnectionManager.
  *
  */
 
 #define DEFAULT_TIMEOUT 300     // 5 minutes
 #define CGI_DEFAULT_TIMEOUT 300 // 20 seconds
+#define DEFAULT_KEEPALIVE_TIMEOUT 75 // seconds
 
 #include "../logger/ILogger.hpp"
+#include "../utils/Arena.hpp"
 #include "IConnection.hpp"
 #include <ctime>
 
@@ -24,28 +29,37 @@ class Connection : public IConnection
 {
 private:
     SocketDescriptor_t
-        m_socket_descriptor;        // Socket descriptor for the connection
-    std::string m_ip;               // Client's IP address
-    int m_port;                     // Port number
-    std::string m_remote_address;   // Remote address
-    int m_cgi_output_pipe_read_end; // Read pipe descriptor for the response
-    int m_cgi_pid;                  // PID of the CGI process
-    ILogger &m_logger;              // Reference to the logger
-    IRequest *m_request;            // Pointer to the request object
-    IResponse *m_response;          // Pointer to the response object
-    ISession *m_session;            // Pointer to the session object
-    const time_t m_timeout;         // Timeout for the connection
-    time_t m_last_access;           // Last access time
-    time_t m_cgi_start_time;        // Cgi start time
+        m_socket_descriptor;          // Socket descriptor for the connection
+    std::string m_ip;                 // Client's IP address
+    int m_port;                       // Port number
+    std::string m_remote_address;     // Remote address
+    int m_cgi_output_pipe_read_end;   // Read pipe descriptor for the response
+    int m_cgi_pid;                    // PID of the CGI process
+    ILogger &m_logger;                // Reference to the logger
+    IRequest *m_request;              // Pointer to the request object
+    IResponse *m_response;            // Pointer to the response object
+    Arena *m_arena;                   // Storage of the request and response
+    SessionId_t m_session_id;         // Session of the client, 0 for none
+    const time_t m_timeout;           // Timeout for the connection
+    const time_t m_keepalive_timeout; // Timeout between two requests
+    bool m_keep_alive;                // Keep the connection after the response
+    bool m_idle;                      // Waiting for the next request
+    bool m_busy;                      // Pipelined requests wait for a CGI
+    size_t m_request_count;           // Requests completed on the connection
+    time_t m_last_access;             // Last access time
+    time_t m_cgi_start_time;          // Cgi start time
+    Timer m_timer;                    // Timer for the connection deadline
+    Timer m_cgi_timer;                // Timer for the CGI deadline
 
 public:
     Connection(std::pair<int, std::pair<std::string, std::string> > client_info,
-               ILogger &logger, IRequest *request, IResponse *response,
-               time_t timeout = DEFAULT_TIMEOUT);
+               ILogger &logger, Arena *arena, IRequest *request,
+               IResponse *response, time_t timeout = DEFAULT_TIMEOUT,
+               time_t keepalive_timeout = DEFAULT_KEEPALIVE_TIMEOUT);
     virtual ~Connection();
 
     // Setters
-    virtual void setSession(ISession *session);
+    virtual void setSessionId(SessionId_t session_id);
     virtual void clearCgiInfo();
 
     // Getters
@@ -56,14 +70,30 @@ public:
     virtual int getCgiOutputPipeReadEnd() const;
     virtual IRequest &getRequest() const;
     virtual IResponse &getResponse() const;
-    virtual ISession &getSession() const;
+    virtual SessionId_t getSessionId() const;
     virtual int getCgiPid() const;
     virtual void setCgiInfo(int pid, int response_read_pipe_fd);
 
+    // Persistent connection
+    virtual void setKeepAlive(bool keep_alive);
+    virtual bool isKeepAlive() const;
+    virtual size_t getRequestCount() const;
+    virtual void recycle(); // Prepare for the next request
+    virtual void setIdle(); // Wait for the next request
+    virtual void setBusy(bool busy);
+    virtual bool isBusy() const; // A CGI process serves the request
+
     // Connection management
-    virtual void touch();               // Update the last access time
-    virtual bool hasExpired() const;    // Check if the connection has expired
-    virtual bool cgiHasExpired() const; // Check if the CGI process has expired
+    virtual void
+    reuse(std::pair<int, std::pair<std::string, std::string> > client_info);
+    virtual void release(); // Stop serving the client
+    virtual void touch();   // Update the last access time
+    virtual time_t
+    getDeadline() const; // Time at which the connection expires
+    virtual time_t
+    getCgiDeadline() const;        // Time at which the CGI process expires
+    virtual Timer &getTimer();     // Timer for the connection deadline
+    virtual Timer &getCgiTimer();  // Timer for the CGI deadline
 };
 
 #endif // CONNECTION_HPP
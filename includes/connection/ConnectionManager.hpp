@@ -17,31 +17,47 @@
 #include <sys/wait.h>
 
 #include <map>
+#include <set>
 
+#include "../core/TimerWheel.hpp"
 #include "../factory/IFactory.hpp"
 #include "../logger/ILogger.hpp"
 #include "IConnection.hpp"
 #include "IConnectionManager.hpp"
 #include "ISession.hpp"
+#include "ISessionStore.hpp"
 
 class ConnectionManager : public IConnectionManager
 {
 private:
     std::map<SocketDescriptor_t, IConnection *>
-        m_connections;                            // active connections
-    std::map<SessionId_t, ISession *> m_sessions; // active sessions
-    time_t
-        m_last_garbage_collection; // last time garbage collection was performed
-    IFactory &m_factory; // factory object to create connections and sessions
-    ILogger &m_logger;   // logger object
-
-    // Generate a unique session ID
-    SessionId_t m_generateSessionId() const;
+        m_connections;        // active connections
+    TimerWheel m_timer_wheel; // deadlines of connections and CGIs
+    Timer m_garbage_timer;    // periodic reaping of zombies and idle sessions
+    std::vector<Timer *> m_expired_timers; // timers expired by the last tick
+    std::vector<SocketDescriptor_t>
+        m_expired_connections;       // connections waiting for removal
+    std::set<int> m_cgi_processes; // CGI processes started, until reaped
+    WorkerCounters m_local_counters; // counters used without a master
+    WorkerCounters *m_counters;      // counters currently updated
+    IFactory &m_factory;            // factory object to create connections
+    ISessionStore &m_session_store; // sessions shared by the worker threads
+    ILogger &m_logger;              // logger object
+
+    // Schedule a timer at an absolute deadline
+    void m_schedule(Timer &timer, time_t deadline, time_t now);
+
+    // Handle expired timers
+    void m_expireConnection(SocketDescriptor_t socket_descriptor, time_t now);
+    void m_expireCgiProcess(SocketDescriptor_t socket_descriptor, time_t now);
+
+    // Read a session id from its cookie
     SessionId_t m_stringToSessionId(const std::string &string) const;
 
 public:
     // Constructor
-    ConnectionManager(ILogger &logger, IFactory &factory);
+    ConnectionManager(ILogger &logger, IFactory &factory,
+                      ISessionStore &session_store);
 
     // Destructor
     virtual ~ConnectionManager();
@@ -50,6 +66,7 @@ public:
     virtual void addConnection(
         std::pair<int, std::pair<std::string, std::string> > client_info);
     virtual void removeConnection(SocketDescriptor_t socket_descriptor);
+    virtual void idleConnection(SocketDescriptor_t socket_descriptor);
     virtual IConnection &getConnection(SocketDescriptor_t socket_descriptor);
     virtual IRequest &getRequest(SocketDescriptor_t socket_descriptor);
     virtual IResponse &getResponse(SocketDescriptor_t socket_descriptor);
@@ -57,7 +74,6 @@ public:
     // Methods related to sessions
     virtual SessionId_t addSession();
     virtual void removeSession(SessionId_t id);
-    virtual ISession &getSession(SessionId_t id);
     virtual void setSessionData(SessionId_t id, const std::string &key,
                                 const std::string &value);
     virtual std::string getSessionData(SessionId_t id, const std::string &key);
@@ -68,8 +84,22 @@ public:
                                            const IRequest &request,
                                            IResponse &response);
 
-    // Method to retire idle sessions
+    // Method to record a CGI process and schedule its deadline
+    virtual void trackCgiProcess(IConnection &connection, int cgi_pid,
+                                 int cgi_output_pipe_read_end);
+
+    // Method to expire deadlines
     virtual void collectGarbage();
+
+    // Method to get the connections expired by the last garbage collection
+    virtual std::vector<SocketDescriptor_t> &getExpiredConnections();
+
+    // Method to get the milliseconds until the next deadline, -1 if none
+    virtual int getTimeout() const;
+
+    // Methods to access the activity counters
+    virtual WorkerCounters &getCounters();
+    virtual void setCounters(WorkerCounters *counters);
 };
 
 #endif // CONNECTIONMANAGER_HPP
@@ -16,6 +16,8 @@
 #include <sys/socket.h>
 #include <vector>
 
+class RequestBuffer;
+
 class IClientHandler
 {
 public:
@@ -24,9 +26,14 @@ public:
 
     // Setter
     virtual void setSocketDescriptor(int socket_descriptor) = 0;
+    virtual void setReadBudget(size_t read_budget) = 0;
+
+    // Getters
+    virtual size_t getReadBudget() const = 0;
+    virtual bool isReadPending() const = 0;
 
     // Methods to read and send requests and responses
-    virtual const std::vector<char> readRequest() const = 0;
+    virtual size_t readRequest(RequestBuffer &buffer) const = 0;
     virtual ssize_t sendResponse(const std::vector<char> &response) const = 0;
     virtual ssize_t sendResponse(const std::string &response) const = 0;
 };
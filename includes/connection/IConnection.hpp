@@ -16,8 +16,10 @@
 typedef int SocketDescriptor_t;
 
 #include "../connection/ISession.hpp"
+#include "../core/TimerWheel.hpp"
 #include "../request/IRequest.hpp"
 #include "../response/IResponse.hpp"
+#include <ctime>
 #include <string>
 
 class IConnection
@@ -26,7 +28,7 @@ public:
     virtual ~IConnection() {};
 
     // Setters
-    virtual void setSession(ISession *session) = 0;
+    virtual void setSessionId(SessionId_t session_id) = 0;
     virtual void clearCgiInfo() = 0;
 
     // Getters
@@ -37,15 +39,29 @@ public:
     virtual int getCgiOutputPipeReadEnd() const = 0;
     virtual IRequest &getRequest() const = 0;
     virtual IResponse &getResponse() const = 0;
-    virtual ISession &getSession() const = 0;
+    virtual SessionId_t getSessionId() const = 0;
     virtual int getCgiPid() const = 0;
     virtual void setCgiInfo(int, int) = 0;
 
+    // Persistent connection
+    virtual void setKeepAlive(bool) = 0;
+    virtual bool isKeepAlive() const = 0;
+    virtual size_t getRequestCount() const = 0;
+    virtual void recycle() = 0; // Prepare for the next request
+    virtual void setIdle() = 0; // Wait for the next request
+    virtual void setBusy(bool) = 0;
+    virtual bool isBusy() const = 0; // A CGI process serves the request
+
     // Connection management
-    virtual void touch() = 0;            // Update the last access time
-    virtual bool hasExpired() const = 0; // Check if the connection has expired
-    virtual bool
-    cgiHasExpired() const = 0; // Check if the CGI process has expired
+    virtual void reuse(std::pair<int, std::pair<std::string, std::string> >) = 0;
+    virtual void release() = 0; // Stop serving the client
+    virtual void touch() = 0;   // Update the last access time
+    virtual time_t
+    getDeadline() const = 0; // Time at which the connection expires
+    virtual time_t
+    getCgiDeadline() const = 0; // Time at which the CGI process expires
+    virtual Timer &getTimer() = 0;    // Timer for the connection deadline
+    virtual Timer &getCgiTimer() = 0; // Timer for the CGI deadline
 };
 
 #endif // ICONNECTION_HPP
@@ -12,8 +12,10 @@
  *
  */
 
+#include "../core/WorkerCounters.hpp"
 #include "IConnection.hpp"
 #include <string>
+#include <vector>
 
 class IConnectionManager
 {
@@ -24,6 +26,7 @@ public:
     virtual void
         addConnection(std::pair<int, std::pair<std::string, std::string> >) = 0;
     virtual void removeConnection(SocketDescriptor_t) = 0;
+    virtual void idleConnection(SocketDescriptor_t) = 0;
     virtual IConnection &getConnection(SocketDescriptor_t) = 0;
     virtual IRequest &getRequest(SocketDescriptor_t) = 0;
     virtual IResponse &getResponse(SocketDescriptor_t) = 0;
@@ -31,7 +34,6 @@ public:
     // Methods related to sessions
     virtual SessionId_t addSession() = 0;
     virtual void removeSession(SessionId_t) = 0;
-    virtual ISession &getSession(SessionId_t) = 0;
     virtual void setSessionData(SessionId_t, const std::string &,
                                 const std::string &) = 0;
     virtual std::string getSessionData(SessionId_t, const std::string &) = 0;
@@ -41,8 +43,23 @@ public:
     virtual void assignSessionToConnection(IConnection &, const IRequest &,
                                            IResponse &) = 0;
 
-    // Method to retire idle sessions
+    // Method to record a CGI process and schedule its deadline
+    virtual void trackCgiProcess(IConnection &, int, int) = 0;
+
+    // Method to expire deadlines: idle sessions are retired, CGI processes
+    // are killed and idle connections are queued for removal
     virtual void collectGarbage() = 0;
+
+    // Method to get the connections expired by the last garbage collection
+    virtual std::vector<SocketDescriptor_t> &getExpiredConnections() = 0;
+
+    // Method to get the milliseconds until the next deadline, -1 if none
+    virtual int getTimeout() const = 0;
+
+    // Methods to access the activity counters, which may live in memory
+    // shared with the master process
+    virtual WorkerCounters &getCounters() = 0;
+    virtual void setCounters(WorkerCounters *) = 0;
 };
 
 #endif // ICONNECTIONMANAGER_HPP
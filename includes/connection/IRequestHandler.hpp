@@ -11,13 +11,17 @@ public:
     virtual ~IRequestHandler() {};
 
     virtual Triplet_t handleRequest(int) = 0;
+    virtual Triplet_t handlePipelinedRequests(int) = 0;
     virtual int handlePipeException(int) = 0;
     virtual int handlePipeRead(int) = 0;
     virtual void handleErrorResponse(int, int) = 0;
     virtual void handleErrorResponse(int, HttpStatusCode) = 0;
     virtual void handleRedirectResponse(int, std::string) = 0;
     virtual void removeConnection(int) = 0;
+    virtual bool recycleConnection(int) = 0;
     virtual Triplet_t executeCgi(int) = 0;
+    virtual int rejectCgi(int) = 0;
+    virtual bool hasPendingInput() const = 0;
 };
 
 #endif // IREQUESTHANDLER_HPP
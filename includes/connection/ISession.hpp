@@ -12,7 +12,9 @@
  *
  */
 
+#include "../core/TimerWheel.hpp"
 #include <cstddef>
+#include <ctime>
 #include <string>
 
 typedef size_t SessionId_t;
@@ -22,8 +24,9 @@ class ISession
 public:
     virtual ~ISession() {};
 
-    virtual void touch() = 0;            // Update last access time
-    virtual bool hasExpired() const = 0; // Check if session has expired
+    virtual void touch() = 0;               // Update last access time
+    virtual time_t getDeadline() const = 0; // Time at which session expires
+    virtual Timer &getTimer() = 0;          // Timer for the session deadline
     virtual void setData(const std::string &,
                          const std::string &) = 0; // Set session data
     virtual std::string
@@ -0,0 +1,35 @@
+#ifndef ISESSIONSTORE_HPP
+#define ISESSIONSTORE_HPP
+
+/*
+ * SessionStore Interface
+ *
+ * Holds the sessions of a process. In threaded mode a client's connections
+ * land on any reactor, so every reactor's ConnectionManager uses the same
+ * store; its methods may be called from any thread.
+ *
+ */
+
+#include "ISession.hpp"
+#include <string>
+
+class ISessionStore
+{
+public:
+    virtual ~ISessionStore() {};
+
+    virtual SessionId_t addSession() = 0;          // Create a session
+    virtual bool findSession(SessionId_t) = 0;     // Touch it if it exists
+    virtual void removeSession(SessionId_t) = 0;   // Delete a session
+    virtual void setSessionData(SessionId_t, const std::string &,
+                                const std::string &) = 0;
+    virtual std::string getSessionData(SessionId_t,
+                                       const std::string &) = 0;
+    virtual size_t getNumberOfSessions() = 0;
+
+    // Retire the sessions idle past their timeout; returns their number
+    virtual size_t collectGarbage() = 0;
+};
+
+#endif // ISESSIONSTORE_HPP
+// Path: includes/connection/ISessionStore.hpp
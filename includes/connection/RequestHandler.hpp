@@ -38,8 +38,9 @@
 #include "IRequestHandler.hpp"
 #include <map>
 
-// Forward declaration
+// Forward declarations
 class ISocket;
+class WebservException;
 
 class RequestHandler : public IRequestHandler
 {
@@ -53,11 +54,22 @@ private:
 
     // AResponseGenerator *m_request_handler;                 // Pointer to the
     // recruited request handler
-    HttpHelper m_http_helper; // Helper class for request-related operations
-    ILogger &m_logger;        // Reference to the logger
+    ILogger &m_logger; // Reference to the logger
     const IExceptionHandler
         &m_exception_handler;         // Ref to the exception handler
     std::map<int, int> m_pipe_routes; // pipe descriptors to socket descriptors
+    bool m_pending_input; // Last read stopped at the budget with data left
+    int m_keepalive_timeout;     // Idle seconds between requests, 0 disables
+    size_t m_keepalive_requests; // Requests served per connection
+
+    // private method
+    bool m_isPersistent(IConnection &connection) const;
+
+    // private methods
+    Triplet_t m_processRequest(int socket_descriptor);
+    Triplet_t m_handleError(int socket_descriptor, const RequestResult &result);
+    void m_handleException(int socket_descriptor, const WebservException &e);
+    void m_rejectRequest(int socket_descriptor, HttpStatusCode status_code);
 
     // private method
     int m_sendResponse(int socket_descriptor);
@@ -76,12 +88,21 @@ public:
     // Handles client requests
     Triplet_t handleRequest(int socket_descriptor);
 
+    // Handles the requests already received, in order
+    Triplet_t handlePipelinedRequests(int socket_descriptor);
+
     // Handles exceptions related to pipe events
     int handlePipeException(int pipe_descriptor);
 
+    // Answers 503 to a CGI request that found no free pollfd slot
+    int rejectCgi(int descriptor);
+
     // Handles reading response from pipe
     int handlePipeRead(int pipe_descriptor);
 
+    // Checks if the last socket or pipe read left data for the next pass
+    bool hasPendingInput() const;
+
     // Handles error responses
     void handleErrorResponse(int socket_descriptor, int status_code);
     void handleErrorResponse(int socket_descriptor, HttpStatusCode status_code);
@@ -92,6 +113,9 @@ public:
     // Remove and close the connection
     void removeConnection(int socket_descriptor);
 
+    // Keep the connection open for the next request if the response allows it
+    bool recycleConnection(int socket_descriptor);
+
     // Execute CGI
     Triplet_t executeCgi(int body_descriptor);
 };
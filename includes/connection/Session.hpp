@@ -26,6 +26,7 @@ private:
     const time_t m_timeout; // Time elapsed before session expires
     time_t m_last_access;   // Last time session was accessed
     std::map<std::string, std::string> m_data; // Session data
+    Timer m_timer; // Timer for the session deadline
 
 public:
     // Constructor
@@ -34,8 +35,9 @@ public:
     // Destructor
     ~Session();
 
-    virtual void touch();            // Update last access time
-    virtual bool hasExpired() const; // Check if session has expired
+    virtual void touch();               // Update last access time
+    virtual time_t getDeadline() const; // Time at which session expires
+    virtual Timer &getTimer();          // Timer for the session deadline
     virtual void setData(const std::string &key,
                          const std::string &value); // Set session data
     virtual std::string
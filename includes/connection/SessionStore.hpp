@@ -0,0 +1,70 @@
+#ifndef SESSIONSTORE_HPP
+#define SESSIONSTORE_HPP
+
+/*
+ * SessionStore
+ *
+ * The sessions of a process, shared by its worker threads. Every method
+ * locks the store's mutex, so a session can be created by one reactor and
+ * found by another, whichever thread the kernel hands the next connection
+ * of the client to.
+ *
+ * Session ids are drawn from a single generator (xorshift64*) under the same
+ * mutex. It is seeded from /dev/urandom by the process that draws the first
+ * id; a forked worker process reseeds its copy, so workers do not hand out
+ * the same ids.
+ *
+ * Idle sessions are retired by collectGarbage(), which the ConnectionManagers
+ * call with their periodic garbage collection.
+ *
+ * Example:
+ *
+ * SessionStore session_store(factory);
+ * ConnectionManager connection_manager(logger, factory, session_store);
+ */
+
+#include "../core/TimerWheel.hpp"
+#include "../factory/IFactory.hpp"
+#include "ISessionStore.hpp"
+#include <map>
+#include <pthread.h>
+#include <stdint.h>
+#include <sys/types.h>
+#include <vector>
+
+class SessionStore : public ISessionStore
+{
+private:
+    std::map<SessionId_t, ISession *> m_sessions; // active sessions
+    TimerWheel m_timer_wheel;              // idle deadlines of the sessions
+    std::vector<Timer *> m_expired_timers; // timers expired by the last tick
+    uint64_t m_random_state;               // state of the id generator
+    pid_t m_random_pid;                    // process that seeded it, 0 for none
+    IFactory &m_factory;                   // factory object to create sessions
+    pthread_mutex_t m_mutex;               // serialises the reactors
+
+    // Non-copyable
+    SessionStore(const SessionStore &);
+    SessionStore &operator=(const SessionStore &);
+
+    // Called with the mutex locked
+    SessionId_t m_generateSessionId();
+    void m_seed();
+    void m_schedule(ISession &session, time_t now);
+
+public:
+    explicit SessionStore(IFactory &factory);
+    virtual ~SessionStore();
+
+    virtual SessionId_t addSession();
+    virtual bool findSession(SessionId_t id);
+    virtual void removeSession(SessionId_t id);
+    virtual void setSessionData(SessionId_t id, const std::string &key,
+                                const std::string &value);
+    virtual std::string getSessionData(SessionId_t id, const std::string &key);
+    virtual size_t getNumberOfSessions();
+    virtual size_t collectGarbage();
+};
+
+#endif // SESSIONSTORE_HPP
+// Path: includes/connection/SessionStore.hpp
@@ -20,16 +20,23 @@
  * if (helper.isHeaderName(header)) {std::cout << "Valid header name." <<
  * std::endl;}
  *
+ * HttpHeader http_header;
+ * if (helper.findHeader("Content-Type", 12, http_header)) {...}
+ *
  * Note: Invalid input to Map searches will throw an UnknownHeaderError
  * exception.
  *
  * IMPORTANT: Header strings representations in this class are all lowercase.
+ * Searches are case-insensitive.
+ *
+ * The names are static tables shared by all the instances, so a helper costs
+ * nothing to construct. Header names are found with a perfect hash, see
+ * HttpHeaderHelper.cpp.
  *
  */
 
-#include <map>
+#include <cstddef>
 #include <string>
-#include <vector>
 
 enum HttpHeader
 {
@@ -172,26 +179,12 @@ enum HttpHeader
     // Cookie Headers
     COOKIE,     // Request header for receiving cookies
     SET_COOKIE, // Response header for setting cookies
+
+    HTTP_HEADER_COUNT // Number of headers, not a header
 };
 
 class HttpHeaderHelper
 {
-private:
-    // Member variables
-    const std::vector<std::string>
-        m_header_list; // List of string representations of HTTP headers
-    const std::map<std::string, HttpHeader>
-        m_string_http_header_map; // Map of string representations to HttpHeader
-                                  // enum values
-    const std::map<HttpHeader, std::string>
-        m_http_header_string_map; // Map of HttpHeader enum values to string
-                                  // representations
-
-    // Private member functions for initialization
-    static std::vector<std::string> m_setHeaderList();
-    static std::map<std::string, HttpHeader> m_setStringHttpHeaderMap();
-    static std::map<HttpHeader, std::string> m_setHttpHeaderStringMap();
-
 public:
     // Constructor
     HttpHeaderHelper();
@@ -202,6 +195,9 @@ public:
     HttpHeader stringHttpHeaderMap(const std::string &header)
         const; // Get HttpHeader enum value from string representation
 
+    // Member function to find a header from its name, in any case
+    bool findHeader(const char *name, size_t length, HttpHeader &header) const;
+
     // Member function to check if a string is a valid HTTP header
     bool isHeaderName(const std::string &header)
         const; // Check if a string is a valid HTTP header
@@ -9,6 +9,10 @@
  * encapsulates instances of helper classes for HTTP methods, versions, headers
  * and status codes, providing convenient access to their functionality.
  *
+ * The vocabulary tables are static; only the custom error pages are read from
+ * the configuration. A single instance is created in main() and shared by
+ * every reactor, it is never modified.
+ *
  * Path: includes/constants/HttpHelper.hpp
  */
 
@@ -42,6 +46,8 @@ public:
         const; // Check if a string is a valid HTTP method
     bool isSupportedMethod(const std::string &method)
         const; // Check if a string is a supported HTTP method
+    bool findMethod(const char *name, size_t length, HttpMethod &method)
+        const; // Find a method from its name
 
     // Http Version Helper Functions
     const std::string &httpVersionStringMap(
@@ -50,6 +56,8 @@ public:
         const; // Get HttpVersion enum value from string representation
     bool isHttpVersion(const std::string &version)
         const; // Check if a string represents a valid HTTP version
+    bool findHttpVersion(const char *name, size_t length, HttpVersion &version)
+        const; // Find a version from its string representation
 
     // Http Header Helper Functions
     const std::string &httpHeaderStringMap(
@@ -58,9 +66,11 @@ public:
         const; // Get HttpHeader enum value from string representation
     bool isHeaderName(const std::string &header)
         const; // Check if a string represents a valid HTTP header
+    bool findHeader(const char *name, size_t length, HttpHeader &header)
+        const; // Find a header from its name, in any case
 
     // Http Status Code Helper Functions
-    const std::string &httpStatusCodeStringMap(HttpStatusCode statusCode)
+    std::string httpStatusCodeStringMap(HttpStatusCode statusCode)
         const; // Get string representation of HttpStatusCode
     HttpStatusCode stringHttpStatusCodeMap(const std::string &statusCode)
         const; // Get HttpStatusCode enum value from string representation
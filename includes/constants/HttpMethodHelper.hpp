@@ -24,11 +24,14 @@
  * exception.
  *
  * IMPORTANT: Method strings representations in this class are all UPPERCASE.
+ * Methods are case-sensitive.
+ *
+ * The names are a static table shared by all the instances; a search is a
+ * switch on the first character and one comparison.
  */
 
-#include <map>
+#include <cstddef>
 #include <string>
-#include <vector>
 
 enum HttpMethod
 {
@@ -47,31 +50,13 @@ enum HttpMethod
     PATCH = 6,  // The PATCH method applies partial modifications to a resource.
     TRACE = 7,  // The TRACE method performs a message loop-back test along the
                 // path to the target resource.
-    CONNECT = 8 // The CONNECT method establishes a tunnel to the server
-                // identified by the target resource.
+    CONNECT = 8, // The CONNECT method establishes a tunnel to the server
+                 // identified by the target resource.
+    HTTP_METHOD_COUNT // Number of methods, not a method
 };
 
 class HttpMethodHelper
 {
-private:
-    // Member variables
-    const std::vector<std::string>
-        m_method_list; // List of string representations of HTTP methods
-    const std::vector<std::string>
-        m_supported_methods; // Set of string representations of HTTP methods
-    const std::map<std::string, HttpMethod>
-        m_string_http_method_map; // Map of string representations to HttpMethod
-                                  // enum values
-    const std::map<HttpMethod, std::string>
-        m_http_method_string_map; // Map of HttpMethod enum values to string
-                                  // representations
-
-    // Private member functions for initialization
-    static std::vector<std::string> m_setMethodList();
-    const std::vector<std::string> m_setSupportedMethods();
-    static std::map<std::string, HttpMethod> m_setStringHttpMethodMap();
-    static std::map<HttpMethod, std::string> m_setHttpMethodStringMap();
-
 public:
     // Constructor
     HttpMethodHelper();
@@ -85,6 +70,9 @@ public:
     HttpMethod stringHttpMethodMap(const std::string &method)
         const; // Get HttpMethod enum value from string representation
 
+    // Member function to find a method from its name
+    bool findMethod(const char *name, size_t length, HttpMethod &method) const;
+
     // Member function to check if a string is a valid HTTP method
     bool isMethod(const std::string &method)
         const; // Check if a string is a valid HTTP method
@@ -18,6 +18,9 @@
  * std::string meaning = helper.httpStatusCodeStringMap(status_code);
  * std::string htmlPage = helper.getErrorResponse(status_code);
  *
+ * The reason phrases are a static table indexed by the status code, shared by
+ * all the instances; only the custom error pages belong to an instance.
+ *
  */
 
 #include <map>
@@ -177,23 +180,10 @@ class HttpStatusCodeHelper
 {
 private:
     // Member variables
-    const std::vector<std::string>
-        m_status_code_list; // List of string representations of HTTP versions
-    const std::map<std::string, HttpStatusCode>
-        m_string_http_status_code_map; // Map of string representations to
-                                       // HttpStatusCode enum values
-    const std::map<HttpStatusCode, std::string>
-        m_http_status_code_string_map; // Map of HttpStatusCode enum values to
-                                       // string representations
-    const std::map<std::string, std::string>
-        m_status_code_description; // Map of status code to description
     const std::map<HttpStatusCode, std::string>
         m_status_code_html_page_map; // Map of status code to html page
 
     // Private member functions for initialization
-    static std::vector<std::string> m_setStatusCodeList();
-    static std::map<std::string, HttpStatusCode> m_setStringHttpStatusCodeMap();
-    static std::map<HttpStatusCode, std::string> m_setHttpStatusCodeStringMap();
     std::map<HttpStatusCode, std::string>
     m_setStatusCodeHtmlPageMap(std::vector<std::string> error_page);
 
@@ -203,7 +193,7 @@ public:
         std::vector<std::string> error_page = std::vector<std::string>());
 
     // Member functions to access data
-    const std::string &httpStatusCodeStringMap(HttpStatusCode status_code)
+    std::string httpStatusCodeStringMap(HttpStatusCode status_code)
         const; // Get string representation of HttpStatusCode
     HttpStatusCode stringHttpStatusCodeMap(const std::string &status_code)
         const; // Get HttpStatusCode enum value from string representation
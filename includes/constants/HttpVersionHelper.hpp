@@ -24,11 +24,13 @@
  * exception.
  *
  * IMPORTANT: Version strings representations in this class are all UPPERCASE.
+ *
+ * The names are a static table shared by all the instances; a search is a
+ * switch on the version digits.
  */
 
-#include <map>
+#include <cstddef>
 #include <string>
-#include <vector>
 
 enum HttpVersion
 {
@@ -43,29 +45,14 @@ enum HttpVersion
     HTTP_2_0, // HTTP/2: Introduced in 2015, a major overhaul of the protocol
               // focused on performance and efficiency. Introduced features like
               // multiplexing and header compression.
-    HTTP_3_0  // HTTP/3: Still in development, based on the QUIC protocol. Aims
+    HTTP_3_0, // HTTP/3: Still in development, based on the QUIC protocol. Aims
               // to improve performance and security, especially for web
               // applications.
+    HTTP_VERSION_COUNT // Number of versions, not a version
 };
 
 class HttpVersionHelper
 {
-private:
-    // Member variables
-    const std::vector<std::string>
-        m_version_list; // List of string representations of HTTP versions
-    const std::map<std::string, HttpVersion>
-        m_string_http_version_map; // Map of string representations to
-                                   // HttpVersion enum values
-    const std::map<HttpVersion, std::string>
-        m_http_version_string_map; // Map of HttpVersion enum values to string
-                                   // representations
-
-    // Private member functions for initialization
-    static std::vector<std::string> m_setVersionList();
-    static std::map<std::string, HttpVersion> m_setStringHttpVersionMap();
-    static std::map<HttpVersion, std::string> m_setHttpVersionStringMap();
-
 public:
     // Constructor
     HttpVersionHelper();
@@ -76,6 +63,10 @@ public:
     HttpVersion stringHttpVersionMap(const std::string &version)
         const; // Get HttpVersion enum value from string representation
 
+    // Member function to find a version from its string representation
+    bool findHttpVersion(const char *name, size_t length,
+                         HttpVersion &version) const;
+
     // Member function to check if a string represents a valid HTTP version
     bool isHttpVersion(const std::string &version) const;
 };
@@ -0,0 +1,82 @@
+#ifndef EPOLLPOLLINGSERVICE_HPP
+#define EPOLLPOLLINGSERVICE_HPP
+
+/*
+ * EpollPollingService.hpp
+ *
+ * epoll backed implementation of IPollingService (Linux only).
+ *
+ * The interest set lives in the kernel and is kept in sync through the
+ * register/modify/unregister notifications sent by the PollfdManager, so a
+ * cycle costs O(ready) instead of O(registered). epoll_wait() results are
+ * written back into the revents field of the matching pollfd and the
+ * descriptor is appended to the PollfdManager's ready list, which is what the
+ * EventManager walks.
+ *
+ * Regular files cannot be registered with epoll (EPERM); like poll() we treat
+ * them as always ready and report their requested events on every cycle.
+ *
+ * In edge-triggered mode, client sockets and pipes are registered with
+ * EPOLLET. Server sockets stay level-triggered since a readiness event only
+ * accepts a single connection.
+ *
+ * Example (configuration):
+ *
+ * events {
+ *     use epoll;
+ *     epoll_edge_triggered on;
+ * }
+ */
+
+#include "../logger/ILogger.hpp"
+#include "../pollfd/IPollfdManager.hpp"
+#include "IPollingService.hpp"
+#include <map>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/epoll.h>
+
+class EpollPollingService : public IPollingService
+{
+private:
+    IPollfdManager &m_pollfd_manager;
+    ILogger &m_logger;
+    int m_timeout;
+    int m_epoll_descriptor;
+    bool m_edge_triggered;
+    std::vector<epoll_event> m_events; // epoll_wait() output buffer
+    std::map<int, short>
+        m_synthetic_events; // Descriptors epoll refuses, reported every cycle
+
+    uint32_t m_toEpollEvents(short events, DescriptorType type) const;
+    short m_toPollEvents(uint32_t events) const;
+    void m_reportReady(int descriptor, short revents);
+
+public:
+    EpollPollingService(IPollfdManager &pollfd_manager, ILogger &logger,
+                        bool edge_triggered = false, int timeout = 100);
+    ~EpollPollingService();
+
+    virtual void pollEvents();
+    virtual void setPollingTimeout(int timeout);
+
+    virtual void registerDescriptor(int descriptor, short events,
+                                    DescriptorType type);
+    virtual void modifyDescriptor(int descriptor, short events,
+                                  DescriptorType type);
+    virtual void unregisterDescriptor(int descriptor);
+
+    // No file transfers: the buffers read and write the files themselves
+    virtual bool submitFileRead(int owner, int descriptor, void *data,
+                                size_t size, off_t offset);
+    virtual bool submitFileWrite(int owner, int descriptor, const void *data,
+                                 size_t size);
+    virtual bool isFileIoPending(int owner) const;
+    virtual ssize_t completeFileIo(int owner);
+};
+
+#endif // __linux__
+
+#endif // EPOLLPOLLINGSERVICE_HPP
+// Path: includes/core/EpollPollingService.hpp
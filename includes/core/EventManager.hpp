@@ -8,6 +8,7 @@
 #include "../network/IServer.hpp"
 #include "../pollfd/IPollfdManager.hpp"
 #include "IEventManager.hpp"
+#include "LoopProfiler.hpp"
 
 typedef std::pair<int, std::pair<int, int> > Triplet_t;
 
@@ -19,27 +20,33 @@ private:
     IConnectionManager &m_connection_manager;
     IServer &m_server;
     IRequestHandler &m_request_handler;
+    LoopProfiler &m_loop_profiler;
     ILogger &m_logger;
 
     // Event handling functions for different types of files
     void m_handleRegularFileEvents(ssize_t &pollfd_index, short events);
-    void m_handleServerSocketEvents(ssize_t pollfd_index, short events);
+    void m_handleServerSocketEvents(ssize_t &pollfd_index, short events);
     void m_handleClientSocketEvents(ssize_t &pollfd_index, short events);
     void m_handlePipeEvents(ssize_t &pollfd_index, short events);
 
     // helper functions
     void m_handleRequest(ssize_t &pollfd_index);
+    void m_handleRequestResult(ssize_t &pollfd_index, Triplet_t info);
     void m_handleClientException(ssize_t &pollfd_index, short events);
     ssize_t m_flushBuffer(ssize_t &pollfd_index, short options = 0);
     void m_cleanUp(ssize_t &pollfd_index, int descriptor, short options = 0);
+    void m_rejectCgi(int descriptor);
+    void m_resumeClient(int client_socket);
 
 public:
     EventManager(IPollfdManager &pollfd_manager, IBufferManager &buffer_manager,
                  IConnectionManager &connection_manager, IServer &server,
-                 IRequestHandler &request_handler, ILogger &logger);
+                 IRequestHandler &request_handler,
+                 LoopProfiler &loop_profiler, ILogger &logger);
     ~EventManager();
 
     virtual void handleEvents();
+    virtual void handleTimeouts();
 };
 
 #endif // EVENTMANAGER_HPP
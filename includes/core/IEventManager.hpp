@@ -13,6 +13,7 @@ public:
     virtual ~IEventManager() {}
 
     virtual void handleEvents() = 0;
+    virtual void handleTimeouts() = 0;
 };
 
 #endif // IEVENTMANAGER_HPP
@@ -5,8 +5,23 @@
  * IPollingService.hpp
  *
  * Abstract class for handling polling events.
+ *
+ * Backends that keep their own interest set in the kernel (epoll) are notified
+ * by the PollfdManager whenever a descriptor is added, modified or removed.
+ * Backends that rebuild the interest set on every call (poll) simply ignore
+ * those notifications.
+ *
+ * Backends that can transfer file data asynchronously (io_uring) also take
+ * file reads and writes from the buffers. A transfer is submitted with the
+ * next poll; once it completes, its owner (the descriptor whose buffer
+ * started it) is reported ready for writing, and completeFileIo() returns
+ * its result. The other backends refuse transfers, and the buffers read and
+ * write the files themselves.
  */
 
+#include "../pollfd/IPollfdManager.hpp"
+#include <sys/types.h>
+
 class IPollingService
 {
 public:
@@ -14,6 +29,25 @@ public:
 
     virtual void pollEvents() = 0;
     virtual void setPollingTimeout(int) = 0;
+
+    // Interest set notifications sent by the PollfdManager
+    virtual void registerDescriptor(int descriptor, short events,
+                                    DescriptorType type) = 0;
+    virtual void modifyDescriptor(int descriptor, short events,
+                                  DescriptorType type) = 0;
+    virtual void unregisterDescriptor(int descriptor) = 0;
+
+    // Asynchronous file transfers, at most one per owner. submitFileRead()
+    // reads at 'offset', submitFileWrite() writes at the file position; both
+    // return false when the backend does not do transfers. The memory must
+    // stay valid until completeFileIo(), which waits for the transfer if
+    // needed and returns the number of bytes moved, or -1 with errno set.
+    virtual bool submitFileRead(int owner, int descriptor, void *data,
+                                size_t size, off_t offset) = 0;
+    virtual bool submitFileWrite(int owner, int descriptor, const void *data,
+                                 size_t size) = 0;
+    virtual bool isFileIoPending(int owner) const = 0;
+    virtual ssize_t completeFileIo(int owner) = 0;
 };
 
 #endif // IPOLLINGSERVICE_HPP
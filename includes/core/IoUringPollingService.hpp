@@ -0,0 +1,142 @@
+#ifndef IOURINGPOLLINGSERVICE_HPP
+#define IOURINGPOLLINGSERVICE_HPP
+
+/*
+ * IoUringPollingService.hpp
+ *
+ * io_uring backed implementation of IPollingService (Linux 5.11 and later).
+ *
+ * Every registered descriptor has a one-shot IORING_OP_POLL_ADD in flight.
+ * When it completes, the events are written back into the revents field of
+ * the matching pollfd, the descriptor is appended to the PollfdManager's
+ * ready list and the poll is re-armed on the next cycle. Re-arming a
+ * descriptor that is still ready completes at once, which gives the same
+ * level-triggered behaviour as poll() and epoll.
+ *
+ * Interest set changes (adds, POLLOUT updates, removals, re-arms) are queued
+ * as submissions and handed to the kernel together with the wait, in a single
+ * io_uring_enter() per cycle for all connections. Regular files need no
+ * special case: the kernel reports them as always ready.
+ *
+ * Stale completions (for a descriptor that was removed or modified since the
+ * poll was submitted) are recognised by a generation number stored next to
+ * the descriptor in the user data and dropped.
+ *
+ * File data is moved with IORING_OP_READ (the files of static responses,
+ * read by the SocketBuffer) and IORING_OP_WRITE (FileBuffer flushes), so a
+ * disk access does not stall the core cycle the way read() or sendfile() on
+ * a cold page cache would. The transfers go to the kernel with the polls. A
+ * descriptor waiting for a transfer is not polled: the completion reports it
+ * ready for writing, and the EventManager flushes its buffer again, which
+ * collects the result.
+ *
+ * The constructor throws IoUringSetupError when io_uring is unavailable
+ * (old kernel, seccomp, 'kernel.io_uring_disabled'); the caller then falls
+ * back to epoll or poll.
+ *
+ * Example (configuration):
+ *
+ * events {
+ *     use io_uring;
+ * }
+ */
+
+#include "../logger/ILogger.hpp"
+#include "../pollfd/IPollfdManager.hpp"
+#include "IPollingService.hpp"
+#include <vector>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+
+#if defined(__linux__) && defined(__NR_io_uring_setup)
+#define WEBSERV_IO_URING
+#include <linux/io_uring.h>
+
+#define IO_URING_SQ_ENTRIES 256 // Submissions queued before a forced submit
+
+// Per descriptor state, indexed by descriptor
+struct IoUringDescriptor
+{
+    unsigned int generation; // Tags the submissions for this descriptor
+    short events;            // Requested events
+    bool registered;         // Part of the interest set
+    bool armed;              // A poll is in flight
+    bool queued;             // Waiting in m_arm_queue
+    bool reported;           // In the ready list of this cycle
+    bool transferring;       // A file transfer of this owner is in flight
+    int result;              // Result of its last file transfer
+};
+
+class IoUringPollingService : public IPollingService
+{
+private:
+    IPollfdManager &m_pollfd_manager;
+    ILogger &m_logger;
+    int m_timeout;
+    int m_ring_descriptor;
+
+    // Submission ring
+    void *m_sq_ring;
+    size_t m_sq_ring_size;
+    unsigned int *m_sq_head;
+    unsigned int *m_sq_tail;
+    unsigned int m_sq_mask;
+    unsigned int *m_sq_array;
+    io_uring_sqe *m_sqes;
+    size_t m_sqes_size;
+    unsigned int m_to_submit; // Queued but not yet submitted
+
+    // Completion ring
+    void *m_cq_ring;
+    size_t m_cq_ring_size;
+    unsigned int *m_cq_head;
+    unsigned int *m_cq_tail;
+    unsigned int m_cq_mask;
+    io_uring_cqe *m_cqes;
+
+    std::vector<IoUringDescriptor> m_descriptors;
+    std::vector<int> m_arm_queue; // Descriptors to (re-)arm before waiting
+    unsigned int m_transfers;     // File transfers in flight
+
+    void m_setup(unsigned int completion_entries);
+    void m_release();
+    IoUringDescriptor &m_getDescriptor(int descriptor);
+    io_uring_sqe *m_getSqe();
+    int m_enter(unsigned int min_complete, int timeout);
+    void m_queueArm(int descriptor);
+    void m_armQueued();
+    void m_cancel(int descriptor);
+    void m_reapCompletions();
+    void m_reportReady(int descriptor, short revents);
+    void m_submitTransfer(unsigned char opcode, int owner, int descriptor,
+                          void *data, size_t size, off_t offset);
+    void m_completeTransfer(int owner, int result);
+
+public:
+    IoUringPollingService(IPollfdManager &pollfd_manager, ILogger &logger,
+                          int timeout = 100);
+    ~IoUringPollingService();
+
+    virtual void pollEvents();
+    virtual void setPollingTimeout(int timeout);
+
+    virtual void registerDescriptor(int descriptor, short events,
+                                    DescriptorType type);
+    virtual void modifyDescriptor(int descriptor, short events,
+                                  DescriptorType type);
+    virtual void unregisterDescriptor(int descriptor);
+
+    virtual bool submitFileRead(int owner, int descriptor, void *data,
+                                size_t size, off_t offset);
+    virtual bool submitFileWrite(int owner, int descriptor, const void *data,
+                                 size_t size);
+    virtual bool isFileIoPending(int owner) const;
+    virtual ssize_t completeFileIo(int owner);
+};
+
+#endif // WEBSERV_IO_URING
+
+#endif // IOURINGPOLLINGSERVICE_HPP
+// Path: includes/core/IoUringPollingService.hpp
@@ -0,0 +1,108 @@
+#ifndef LOOPPROFILER_HPP
+#define LOOPPROFILER_HPP
+
+/*
+ * LoopProfiler.hpp
+ *
+ * Timing of the webserv core cycle.
+ *
+ * Every phase of an iteration (polling, event handling, garbage collection)
+ * and every descriptor handler called by the EventManager is timed with the
+ * monotonic clock and counted in a fixed-bucket histogram. The histograms are
+ * logged every LOOP_PROFILER_REPORT_INTERVAL seconds.
+ *
+ * Time spent waiting in the poll is idle time. When the rest of an iteration
+ * takes longer than 'events { stall_threshold ...; }' milliseconds, a warning
+ * names the slowest handler of the iteration and its descriptor: a
+ * synchronous file read or a fork in a handler delays every other client.
+ * A threshold of 0 disables the warning.
+ *
+ * Example:
+ *
+ * loop_profiler.startIteration();
+ * polling_service->pollEvents();
+ * loop_profiler.endPhase(LOOP_PHASE_POLL);
+ * event_manager.handleEvents(); // times each handler
+ * loop_profiler.endPhase(LOOP_PHASE_EVENTS);
+ * ...
+ * loop_profiler.endIteration();
+ */
+
+#include "../configuration/BlockList.hpp"
+#include "../configuration/IConfiguration.hpp"
+#include "../logger/ILogger.hpp"
+#include "../pollfd/IPollfdManager.hpp"
+#include <ctime>
+#include <string>
+
+#define LOOP_HISTOGRAM_BUCKETS 7        // 10us, 100us, 1ms, 10ms, 100ms, 1s, +
+#define LOOP_DESCRIPTOR_TYPES 4         // Number of DescriptorType values
+#define LOOP_PROFILER_REPORT_INTERVAL 60 // seconds between two reports
+
+// Phases of an iteration of the core cycle
+enum LoopPhase
+{
+    LOOP_PHASE_POLL,
+    LOOP_PHASE_EVENTS,
+    LOOP_PHASE_GARBAGE,
+    LOOP_PHASE_COUNT,
+};
+
+// Durations counted by powers of ten of microseconds
+struct LoopHistogram
+{
+    unsigned long buckets[ LOOP_HISTOGRAM_BUCKETS ];
+    unsigned long count;
+    long max; // Longest duration, in microseconds
+};
+
+class LoopProfiler
+{
+private:
+    ILogger &m_logger;
+    long m_stall_threshold; // Busy time of a stalled iteration, in microseconds
+
+    LoopHistogram m_phases[ LOOP_PHASE_COUNT ];
+    LoopHistogram m_handlers[ LOOP_DESCRIPTOR_TYPES ];
+    long m_phase_times[ LOOP_PHASE_COUNT ]; // Durations of this iteration
+
+    long m_mark;          // Start of the current phase
+    long m_handler_start; // Start of the current handler
+
+    // Slowest handler of this iteration
+    long m_slowest_time;
+    DescriptorType m_slowest_type;
+    int m_slowest_descriptor;
+
+    time_t m_last_report;
+
+    static long m_now();
+    static void m_record(LoopHistogram &histogram, long duration);
+    static std::string m_formatDuration(long duration);
+    static std::string m_formatHistogram(const LoopHistogram &histogram);
+
+    void m_warnStall();
+
+public:
+    LoopProfiler(IConfiguration &configuration, ILogger &logger);
+    ~LoopProfiler();
+
+    // Start timing an iteration, and its first phase
+    void startIteration();
+
+    // Record the phase that just ended; the next phase starts now
+    void endPhase(LoopPhase phase);
+
+    // Time a descriptor handler
+    void startHandler();
+    void endHandler(DescriptorType type, int descriptor);
+
+    // Check the iteration for a stall and report the histograms when due
+    void endIteration();
+
+    // Log the histograms
+    void report();
+};
+
+#endif // LOOPPROFILER_HPP
+// Path: includes/core/LoopProfiler.hpp
@@ -20,6 +20,21 @@ public:
 
     virtual void pollEvents();
     virtual void setPollingTimeout(int timeout);
+
+    // poll() reads the interest set from the pollfd array on every call
+    virtual void registerDescriptor(int descriptor, short events,
+                                    DescriptorType type);
+    virtual void modifyDescriptor(int descriptor, short events,
+                                  DescriptorType type);
+    virtual void unregisterDescriptor(int descriptor);
+
+    // No file transfers: the buffers read and write the files themselves
+    virtual bool submitFileRead(int owner, int descriptor, void *data,
+                                size_t size, off_t offset);
+    virtual bool submitFileWrite(int owner, int descriptor, const void *data,
+                                 size_t size);
+    virtual bool isFileIoPending(int owner) const;
+    virtual ssize_t completeFileIo(int owner);
 };
 
 #endif // POLLINGSERVICE_HPP
@@ -0,0 +1,101 @@
+#ifndef PROCESSMANAGER_HPP
+#define PROCESSMANAGER_HPP
+
+/*
+ * ProcessManager.hpp
+ *
+ * Master/worker process model honoring the 'worker_processes' directive.
+ *
+ * The master loads the configuration and binds the listening sockets, then
+ * forks one worker per configured process. Every worker runs its own copy of
+ * the webserv core cycle. By default the workers share the listening sockets
+ * inherited from the master; with 'worker_reuseport on' the master closes its
+ * sockets and each worker binds its own with SO_REUSEPORT, letting the kernel
+ * balance connections between them. 'worker_cpu_affinity auto' pins worker N
+ * to the Nth available CPU (Linux only).
+ *
+ * The master does not serve requests: it restarts workers that die, logs the
+ * counters the workers publish in shared memory and, on SIGINT or SIGTERM,
+ * stops the workers before exiting.
+ *
+ * Note that sessions live in the worker that created them.
+ *
+ * Example (configuration):
+ *
+ * worker_processes    4;      # or 'auto', one per CPU
+ * worker_reuseport    on;
+ * worker_cpu_affinity auto;
+ *
+ * Example (usage):
+ *
+ * ProcessManager process_manager(configuration, server, connection_manager,
+ *                                buffer_manager, logger);
+ * if (process_manager.run())
+ *     ... run the core cycle (worker, or single process mode) ...
+ */
+
+#include "../buffer/IBufferManager.hpp"
+#include "../configuration/IConfiguration.hpp"
+#include "../connection/IConnectionManager.hpp"
+#include "../logger/ILogger.hpp"
+#include "../network/IServer.hpp"
+#include "WorkerCounters.hpp"
+#include <csignal>
+#include <ctime>
+#include <vector>
+
+#define WORKER_RESPAWN_DELAY 1     // seconds before respawning a failing slot
+#define WORKER_REPORT_INTERVAL 60  // seconds between two counter reports
+#define WORKER_SHUTDOWN_TIMEOUT 10 // seconds before stopping workers with KILL
+
+class ProcessManager
+{
+private:
+    IConfiguration &m_configuration;
+    IServer &m_server;
+    IConnectionManager &m_connection_manager;
+    IBufferManager &m_buffer_manager;
+    ILogger &m_logger;
+
+    size_t m_worker_processes; // Number of workers, 1 disables the master
+    bool m_reuse_port;         // Each worker binds its own listeners
+    bool m_threaded;           // Workers run threads binding the listeners
+    bool m_cpu_affinity;       // Pin each worker to a CPU
+    WorkerCounters *m_counters; // One slot per worker, shared with workers
+    std::vector<pid_t> m_workers;     // Worker pid per slot, -1 if not running
+    std::vector<time_t> m_respawn_at; // Earliest respawn time per slot
+    time_t m_last_report;             // Time of the last counter report
+    unsigned long m_last_accepted;    // Connections accepted at that time
+
+    struct sigaction m_previous_sigint;  // Handlers restored in the workers
+    struct sigaction m_previous_sigterm; //
+
+    static volatile sig_atomic_t s_shutdown_requested;
+    static void m_shutdownHandler(int signal);
+
+    // Non-copyable
+    ProcessManager(const ProcessManager &);
+    ProcessManager &operator=(const ProcessManager &);
+
+    size_t m_getWorkerProcesses() const;
+    bool m_spawnWorker(size_t slot);
+    void m_setupWorker(size_t slot);
+    void m_setCpuAffinity(size_t slot);
+    void m_reapWorkers();
+    void m_stopWorkers();
+    void m_reportCounters();
+
+public:
+    ProcessManager(IConfiguration &configuration, IServer &server,
+                   IConnectionManager &connection_manager,
+                   IBufferManager &buffer_manager, ILogger &logger);
+    ~ProcessManager();
+
+    // Fork the workers and supervise them. Returns true in a worker (or when
+    // running a single process) which must then run the core cycle, and false
+    // in the master once it was asked to shut down.
+    bool run();
+};
+
+#endif // PROCESSMANAGER_HPP
+// Path: includes/core/ProcessManager.hpp
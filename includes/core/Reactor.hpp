@@ -0,0 +1,112 @@
+#ifndef REACTOR_HPP
+#define REACTOR_HPP
+
+/*
+ * Reactor.hpp
+ *
+ * A complete, self-contained webserv event loop: its own BufferManager,
+ * Logger, PollfdManager, ConnectionManager, Server, Router, RequestHandler,
+ * polling service, LoopProfiler and EventManager. Nothing but the (read-only)
+ * configuration and HttpHelper, the stateless Socket and the SessionStore is
+ * shared with other reactors, so several of them can run on separate threads;
+ * only a session lookup locks on the request path.
+ *
+ * Each reactor binds its own listening sockets with SO_REUSEPORT and the
+ * kernel spreads incoming connections between them. Log files are opened by
+ * every reactor in append mode.
+ *
+ * Example:
+ *
+ * Reactor reactor(socket, configuration, http_helper, session_store, 0);
+ * reactor.start(); // run the core cycle on a new thread
+ * ...
+ * reactor.stop();  // from another thread
+ * reactor.join();
+ */
+
+#include "../buffer/BufferManager.hpp"
+#include "../configuration/IConfiguration.hpp"
+#include "../connection/ClientHandler.hpp"
+#include "../connection/ConnectionManager.hpp"
+#include "../connection/RequestHandler.hpp"
+#include "../exception/ExceptionHandler.hpp"
+#include "../factory/Factory.hpp"
+#include "../logger/Logger.hpp"
+#include "../logger/LoggerConfiguration.hpp"
+#include "../network/ISocket.hpp"
+#include "../network/Server.hpp"
+#include "../pollfd/PollfdManager.hpp"
+#include "../response/Router.hpp"
+#include "EventManager.hpp"
+#include "IPollingService.hpp"
+#include "LoopProfiler.hpp"
+#include <csignal>
+#include <pthread.h>
+
+#define REACTOR_STOP_CHECK_INTERVAL 1000 // max milliseconds between checks
+
+class Reactor
+{
+private:
+    size_t m_index; // Number of the reactor, used in log messages
+    BufferManager m_buffer_manager;
+    Logger m_logger;
+    PollfdManager m_pollfd_manager;
+    LoggerConfiguration *m_logger_configuration;
+    ClientHandler m_client_handler;
+    ExceptionHandler m_exception_handler;
+    Factory m_factory;
+    ConnectionManager m_connection_manager;
+    Server m_server;
+    Router m_router;
+    RequestHandler m_request_handler;
+    IPollingService *m_polling_service;
+    LoopProfiler m_loop_profiler;
+    EventManager m_event_manager;
+    pthread_t m_thread;                     // Thread running the core cycle
+    bool m_started;                         // m_thread was created
+    volatile sig_atomic_t m_stop_requested; // Set by stop()
+    volatile sig_atomic_t m_running;        // Core cycle is running
+
+    // Non-copyable
+    Reactor(const Reactor &);
+    Reactor &operator=(const Reactor &);
+
+    LoggerConfiguration *m_configureLogger(IConfiguration &configuration);
+    static void *m_threadMain(void *reactor);
+
+public:
+    Reactor(ISocket &socket, IConfiguration &configuration,
+            const HttpHelper &http_helper, ISessionStore &session_store,
+            size_t index);
+    ~Reactor();
+
+    // Run the core cycle on the calling thread until stopped or an error
+    void run();
+
+    // Run the core cycle on a new thread
+    bool start();
+
+    // Ask the core cycle to stop; wakes the thread up
+    void stop();
+
+    // Wait for the thread to finish
+    void join();
+
+    bool isRunning() const;
+    IConnectionManager &getConnectionManager();
+
+    // Create the polling service selected by 'events { use ...; }'
+    static IPollingService *createPollingService(IConfiguration &configuration,
+                                                 IPollfdManager &pollfd_manager,
+                                                 ILogger &logger);
+
+    // Apply the per-readiness 'read_budget' and 'write_budget' of the events
+    // block
+    static void configureIoBudgets(IConfiguration &configuration,
+                                   IClientHandler &client_handler,
+                                   IBufferManager &buffer_manager);
+};
+
+#endif // REACTOR_HPP
+// Path: includes/core/Reactor.hpp
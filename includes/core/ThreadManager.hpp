@@ -0,0 +1,89 @@
+#ifndef THREADMANAGER_HPP
+#define THREADMANAGER_HPP
+
+/*
+ * ThreadManager.hpp
+ *
+ * Threaded reactor mode honoring the 'worker_threads' directive.
+ *
+ * Instead of (or on top of) forking, a process can run one Reactor per
+ * thread. Every reactor owns a full event loop and binds its own listening
+ * sockets with SO_REUSEPORT, so the kernel spreads connections between the
+ * threads. The only state shared on the request path is the SessionStore,
+ * since a client's next connection usually lands on another thread. The
+ * listeners bound by the main thread are closed before the reactors start.
+ *
+ * The main thread does not serve requests: it writes the messages logged
+ * through the shared configuration, sums the reactors' counters into the
+ * process counters, and on SIGINT or SIGTERM stops and joins the reactors.
+ * A reactor stopped by an error stops the process, like the single threaded
+ * core cycle does.
+ *
+ * Example (configuration):
+ *
+ * worker_threads 4; # or 'auto', one per CPU
+ *
+ * Example (usage):
+ *
+ * ThreadManager thread_manager(socket, configuration, http_helper,
+ *                              session_store, server, connection_manager,
+ *                              logger);
+ * if (thread_manager.run())
+ *     ... run the core cycle (single threaded mode) ...
+ */
+
+#include "../configuration/IConfiguration.hpp"
+#include "../connection/IConnectionManager.hpp"
+#include "../connection/ISessionStore.hpp"
+#include "../logger/ILogger.hpp"
+#include "../network/IServer.hpp"
+#include "../network/ISocket.hpp"
+#include "Reactor.hpp"
+#include <csignal>
+#include <vector>
+
+class ThreadManager
+{
+private:
+    ISocket &m_socket;
+    IConfiguration &m_configuration;
+    const HttpHelper &m_http_helper;
+    ISessionStore &m_session_store;
+    IServer &m_server;
+    IConnectionManager &m_connection_manager;
+    ILogger &m_logger;
+
+    size_t m_worker_threads;         // Number of reactors, 1 disables them
+    std::vector<Reactor *> m_reactors; // Reactors, one per thread
+
+    static volatile sig_atomic_t s_shutdown_requested;
+    static void m_shutdownHandler(int signal);
+    static void m_wakeUpHandler(int signal);
+
+    // Non-copyable
+    ThreadManager(const ThreadManager &);
+    ThreadManager &operator=(const ThreadManager &);
+
+    void m_installSignalHandlers();
+    bool m_startReactors();
+    void m_stopReactors();
+    void m_sumCounters();
+
+public:
+    ThreadManager(ISocket &socket, IConfiguration &configuration,
+                  const HttpHelper &http_helper, ISessionStore &session_store,
+                  IServer &server, IConnectionManager &connection_manager,
+                  ILogger &logger);
+    ~ThreadManager();
+
+    // Number of threads configured by 'worker_threads'
+    static size_t getWorkerThreads(IConfiguration &configuration);
+
+    // Start the reactors and wait for a shutdown request. Returns true when
+    // running a single thread, which must then run the core cycle itself, and
+    // false once the reactors were stopped.
+    bool run();
+};
+
+#endif // THREADMANAGER_HPP
+// Path: includes/core/ThreadManager.hpp
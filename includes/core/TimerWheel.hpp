@@ -0,0 +1,118 @@
+#ifndef TIMERWHEEL_HPP
+#define TIMERWHEEL_HPP
+
+/*
+ * TimerWheel.hpp
+ *
+ * Hierarchical timing wheel used for connection, session and CGI deadlines.
+ *
+ * Timers are intrusive list nodes owned by the object they time (Connection,
+ * Session, ...), so scheduling and cancelling never allocate and cost O(1).
+ * The wheel has TIMER_WHEEL_LEVELS levels of TIMER_WHEEL_SLOTS slots; level 0
+ * has a resolution of one tick and every level above covers TIMER_WHEEL_SLOTS
+ * times the range of the one below. Timers far in the future cascade down a
+ * level when their slot comes up, so advancing the wheel only touches the
+ * timers that actually expire (plus the rare cascades).
+ *
+ * getTimeout() returns the number of milliseconds until the next slot that
+ * holds timers, which is used as the polling timeout so the server does not
+ * wake up when nothing can expire.
+ *
+ * Example:
+ *
+ * TimerWheel wheel;
+ * Timer timer(TIMER_CONNECTION, socket_descriptor);
+ * wheel.schedule(timer, 30000); // expire in 30 seconds
+ *
+ * std::vector<Timer *> expired;
+ * wheel.advance(expired); // fills 'expired' once the deadline has passed
+ * timer.cancel();         // or the destructor unlinks it
+ */
+
+#include <cstddef>
+#include <vector>
+
+#define TIMER_WHEEL_BITS 6
+#define TIMER_WHEEL_SLOTS (1 << TIMER_WHEEL_BITS) // 64 slots per level
+#define TIMER_WHEEL_LEVELS 4                      // 64^4 ticks of range
+#define TIMER_WHEEL_TICK 10                       // milliseconds per tick
+
+// Types of timers, used by the owner of the wheel to dispatch expirations
+enum TimerType
+{
+    TIMER_GARBAGE,
+    TIMER_CONNECTION,
+    TIMER_SESSION,
+    TIMER_CGI,
+};
+
+class TimerWheel;
+
+class Timer
+{
+private:
+    Timer *m_prev;                // Previous timer in the slot list
+    Timer *m_next;                // Next timer in the slot list
+    TimerWheel *m_wheel;          // Wheel the timer is scheduled on
+    unsigned long long m_expires; // Expiration tick
+    TimerType m_type;             // Type of the timer
+    size_t m_key;                 // Identifier of the timed object
+
+    // Timers are linked into lists and cannot be copied
+    Timer(const Timer &);
+    Timer &operator=(const Timer &);
+
+    friend class TimerWheel;
+
+public:
+    Timer(TimerType type = TIMER_GARBAGE, size_t key = 0);
+    ~Timer();
+
+    // Unlink the timer from its wheel, if scheduled
+    void cancel();
+
+    bool isScheduled() const;
+    TimerType getType() const;
+    size_t getKey() const;
+
+    // Time another object of the same type; cancels the timer
+    void setKey(size_t key);
+};
+
+class TimerWheel
+{
+private:
+    Timer m_slots[ TIMER_WHEEL_LEVELS ]
+                 [ TIMER_WHEEL_SLOTS ]; // Slot list heads (sentinels)
+    unsigned long long m_current;       // Current tick
+    size_t m_size;                      // Number of scheduled timers
+
+    // Non-copyable
+    TimerWheel(const TimerWheel &);
+    TimerWheel &operator=(const TimerWheel &);
+
+    void m_insert(Timer &timer);
+    void m_cascade(size_t level);
+    static unsigned long long m_now();
+
+    friend class Timer;
+
+public:
+    TimerWheel();
+    ~TimerWheel();
+
+    // Schedule (or reschedule) a timer to expire after 'delay' milliseconds
+    void schedule(Timer &timer, unsigned long delay);
+
+    // Move the wheel to the current time and collect the expired timers
+    void advance(std::vector<Timer *> &expired);
+
+    // Milliseconds until the next possible expiration, -1 if none
+    int getTimeout() const;
+
+    // Number of scheduled timers
+    size_t size() const;
+};
+
+#endif // TIMERWHEEL_HPP
+// Path: includes/core/TimerWheel.hpp
@@ -0,0 +1,82 @@
+#ifndef WORKERCOUNTERS_HPP
+#define WORKERCOUNTERS_HPP
+
+/*
+ * WorkerCounters.hpp
+ *
+ * Activity counters of a worker process. In master/worker mode each worker
+ * owns one slot of an array shared with the master (see ProcessManager), so
+ * the master can aggregate them without any message passing. A worker is the
+ * only writer of its slot. In threaded mode the main thread sums the counters
+ * of its reactors the same way.
+ *
+ * The counters are read while their worker updates them: every access goes
+ * through the atomic helpers below.
+ */
+
+#include <sys/types.h>
+
+struct WorkerCounters
+{
+    pid_t pid;                            // Process currently owning the slot
+    unsigned long restarts;               // Times the slot was respawned
+    unsigned long accepted_connections;   // Connections accepted
+    unsigned long accept_batches;         // Readiness events that accepted
+    unsigned long rejected_connections;   // Connections answered 503 at once
+    unsigned long active_connections;     // Connections currently open
+    unsigned long handled_requests;       // Responses queued for sending
+    unsigned long connection_pool_hits;   // Connections reused from the pool
+    unsigned long connection_pool_misses; // Connections allocated
+
+    static void increment(unsigned long &counter);
+    static void store(unsigned long &counter, unsigned long value);
+    static unsigned long load(const unsigned long &counter);
+
+    // Add the activity counters of other to these, read atomically
+    void add(const WorkerCounters &other);
+
+    // Replace the activity counters with the ones of other, written
+    // atomically
+    void publish(const WorkerCounters &other);
+};
+
+inline void WorkerCounters::increment(unsigned long &counter)
+{
+    __atomic_fetch_add(&counter, 1, __ATOMIC_RELAXED);
+}
+
+inline void WorkerCounters::store(unsigned long &counter, unsigned long value)
+{
+    __atomic_store_n(&counter, value, __ATOMIC_RELAXED);
+}
+
+inline unsigned long WorkerCounters::load(const unsigned long &counter)
+{
+    return __atomic_load_n(&counter, __ATOMIC_RELAXED);
+}
+
+inline void WorkerCounters::add(const WorkerCounters &other)
+{
+    restarts += load(other.restarts);
+    accepted_connections += load(other.accepted_connections);
+    accept_batches += load(other.accept_batches);
+    rejected_connections += load(other.rejected_connections);
+    active_connections += load(other.active_connections);
+    handled_requests += load(other.handled_requests);
+    connection_pool_hits += load(other.connection_pool_hits);
+    connection_pool_misses += load(other.connection_pool_misses);
+}
+
+inline void WorkerCounters::publish(const WorkerCounters &other)
+{
+    store(accepted_connections, other.accepted_connections);
+    store(accept_batches, other.accept_batches);
+    store(rejected_connections, other.rejected_connections);
+    store(active_connections, other.active_connections);
+    store(handled_requests, other.handled_requests);
+    store(connection_pool_hits, other.connection_pool_hits);
+    store(connection_pool_misses, other.connection_pool_misses);
+}
+
+#endif // WORKERCOUNTERS_HPP
+// Path: includes/core/WorkerCounters.hpp
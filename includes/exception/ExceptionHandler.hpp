@@ -40,8 +40,6 @@ class ExceptionHandler : public IExceptionHandler
 private:
     ILogger &m_logger; // Reference to the logger instance
     Server *m_server;  // Pointer to the server instance
-    const HttpStatusCodeHelper
-        m_http_status_code_helper; // Helper instance for HTTP status codes
 
     int m_handleWebservException(const WebservException &e,
                                  const std::string &context = "") const;
@@ -118,6 +118,20 @@ public:
     PollError() : WebservException(CRITICAL, "Failed to poll events.", 1) {};
 };
 
+class EpollCreateError : public WebservException
+{
+public:
+    EpollCreateError()
+        : WebservException(CRITICAL, "Failed to create epoll instance.", 1) {};
+};
+
+class IoUringSetupError : public WebservException
+{
+public:
+    IoUringSetupError()
+        : WebservException(ERROR, "Failed to set up io_uring instance.", 1) {};
+};
+
 class SocketCreateError : public WebservException
 {
 public:
@@ -299,12 +313,5 @@ public:
     SigsegvException() : WebservException(CRITICAL, "SIGSEGV received.", 0) {};
 };
 
-class HttpRedirectException : public WebservException
-{
-public:
-    HttpRedirectException(const std::string &location)
-        : WebservException(INFO, location, 0) {};
-};
-
 #endif // WEBSERVEXCEPTIONS_HPP
        // Path: includes/exeption/WebservExceptions.hpp
@@ -4,23 +4,56 @@
 #include "../configuration/IConfiguration.hpp"
 #include "../constants/HttpHelper.hpp"
 #include "../logger/ILogger.hpp"
+#include "../utils/BufferPool.hpp"
 #include "IFactory.hpp"
+#include <ctime>
+#include <vector>
+
+/*
+ * Factory
+ *
+ * Creates the objects owned by the ConnectionManager.
+ *
+ * Released connections are kept with their request and response in a free
+ * list of up to 'connection_pool_size' entries, and handed to the next
+ * clients instead of allocating a new bundle (a Request alone holds about ten
+ * maps and vectors). The hit and miss counts of the pool show in the worker
+ * counters. A pool size of 0 disables pooling.
+ *
+ * Each connection gets an arena of 'request_pool_size' byte blocks for the
+ * maps of its request and response (see Arena).
+ *
+ * The requests receive into chunks of 'receive_chunk_size' bytes from one
+ * pool, which keeps up to 'receive_pool_size' free chunks (see BufferPool).
+ */
 
 class Factory : public IFactory
 {
 private:
     const IConfiguration &m_configuration;
     ILogger &m_logger;
-    const HttpHelper m_http_helper;
+    const HttpHelper &m_http_helper;
+    const time_t m_keepalive_timeout; // Idle time allowed between requests
+    const size_t m_request_pool_size; // Block size of the connection arenas
+    BufferPool m_buffer_pool;         // Chunks the requests receive into
+
+    std::vector<IConnection *> m_connection_pool; // Released connections
+    const size_t m_connection_pool_size;         // Capacity of the pool
+    unsigned long m_pool_hits;                   // Connections reused
+    unsigned long m_pool_misses;                 // Connections allocated
 
 public:
-    Factory(const IConfiguration &configuration, ILogger &m_logger);
+    Factory(const IConfiguration &configuration, const HttpHelper &http_helper,
+            ILogger &m_logger);
     virtual ~Factory();
 
     virtual IConnection *
         createConnection(std::pair<int, std::pair<std::string, std::string> >);
-    virtual IRequest *createRequest();
-    virtual IResponse *createResponse();
+    virtual void releaseConnection(IConnection *connection);
+    virtual unsigned long getPoolHits() const;
+    virtual unsigned long getPoolMisses() const;
+    virtual IRequest *createRequest(Arena &arena);
+    virtual IResponse *createResponse(Arena &arena);
     virtual ISession *createSession(SessionId_t id);
 };
 
@@ -5,6 +5,7 @@
 #include "../connection/ISession.hpp"
 #include "../request/IRequest.hpp"
 #include "../response/IResponse.hpp"
+#include "../utils/Arena.hpp"
 
 class IFactory
 {
@@ -13,8 +14,11 @@ public:
 
     virtual IConnection *createConnection(
         std::pair<int, std::pair<std::string, std::string> >) = 0;
-    virtual IRequest *createRequest() = 0;
-    virtual IResponse *createResponse() = 0;
+    virtual void releaseConnection(IConnection *) = 0;
+    virtual unsigned long getPoolHits() const = 0;
+    virtual unsigned long getPoolMisses() const = 0;
+    virtual IRequest *createRequest(Arena &arena) = 0;
+    virtual IResponse *createResponse(Arena &arena) = 0;
     virtual ISession *createSession(SessionId_t id) = 0;
 };
 
@@ -29,11 +29,20 @@ public:
     virtual int log(const std::string &) = 0; // Method to log error messages
     virtual int log(const LogLevel,
                     const std::string &) = 0; // Method to log error messages
+    virtual int log(const LogLevel,
+                    const char *) = 0;        // Same, for a literal message
     virtual int log(const IConnection &) = 0; // Method to log access events
 
+    // Whether a message at this level is written; a message built from
+    // several parts should only be built when it is
+    virtual bool isEnabled(const LogLevel) const = 0;
+
     // Configuration method
     virtual void configure(ILoggerConfiguration &) = 0; // Method to configure
                                                         // the Logger instance
+
+    // Method to write the buffered messages outside of the core cycle
+    virtual void flush() = 0;
 };
 
 #endif // ILOGGER_HPP
@@ -50,6 +50,7 @@
 #include "../constants/LogLevelHelper.hpp"
 #include "ILogger.hpp"
 #include "ILoggerConfiguration.hpp"
+#include <pthread.h>
 #include <sstream>
 #include <string>
 #include <sys/stat.h>
@@ -61,13 +62,20 @@ private:
     ILoggerConfiguration *m_configuration;
     IBufferManager &m_buffer_manager;
     const LogLevelHelper m_log_level_helper;
+    pthread_mutex_t m_mutex; // Serialises threads sharing this Logger
+    std::string m_message;   // Message being built, storage reused
+    time_t m_timestamp_time; // Second formatted in m_timestamp
+    char m_timestamp[ 20 ];  // "YYYY-MM-DD HH:MM:SS"
 
     // Private methods
-    std::string
-    m_getCurrentTimestamp() const; // Method to get the current timestamp
-    void m_appendMapToLog(std::ostringstream &ss, const std::string &field_name,
-                          const std::map<std::string, std::string> &data_map)
-        const; // Method to append a map to the log message
+    const char *m_getCurrentTimestamp(); // Method to get the current timestamp
+    void m_appendMapToLog(const char *field_name,
+                          const std::map<std::string, std::string>
+                              &data_map); // Method to append a map to the log
+                                          // message
+    void m_appendHeadersToLog(
+        const RequestHeaders &headers); // Method to append the request
+                                        // headers to the log message
     int m_pushToBuffer(const std::string &log_message,
                        const int file_descriptor); // Method to push log
                                                    // messages to the buffer
@@ -86,13 +94,21 @@ public:
     log(const std::string &message); // Default method to log error messages
     virtual int log(const LogLevel logLevel,
                     const std::string &message); // Method to log error messages
+    virtual int log(const LogLevel logLevel,
+                    const char *message); // Same, for a literal message
     virtual int
     log(const IConnection &connection); // Method to log access events
 
+    // Whether a message at this level is written
+    virtual bool isEnabled(const LogLevel logLevel) const;
+
     // Configuration method
     virtual void
     configure(ILoggerConfiguration
                   &configuration); // Method to configure the Logger instance
+
+    // Method to write the buffered messages when no core cycle runs
+    virtual void flush();
 };
 
 #endif // LOGGER_HPP
@@ -8,6 +8,14 @@ public:
 
     virtual void acceptConnection(int) = 0;
     virtual void terminate(int) = 0;
+
+    // Open the listening sockets, optionally with SO_REUSEPORT
+    virtual void openListeners(bool) = 0;
+
+    // Stop listening and close the listening sockets
+    virtual void closeListeners() = 0;
+    // Resume accepting once the load went below the low watermark
+    virtual void updateAdmission() = 0;
 };
 
 #endif // ISERVER_HPP
@@ -12,8 +12,12 @@
 
 #include <string>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <vector>
 
+// Accepted client: socket descriptor, (IP address, port)
+typedef std::pair<int, std::pair<std::string, std::string> > ClientInfo_t;
+
 // Interface for socket operations
 class ISocket
 {
@@ -35,7 +39,8 @@ public:
     // Sets the socket to non-blocking mode
     virtual int setNonBlocking(int fd) const = 0;
 
-    // Accepts an incoming connection
+    // Accepts an incoming connection; the new socket is non-blocking and
+    // close-on-exec
     virtual std::pair<int, std::pair<std::string, std::string> >
     accept(int fd) const = 0;
 
@@ -43,6 +48,18 @@ public:
     virtual int send(int recipient_socket_fd,
                      const std::vector<char> &data) const = 0;
 
+    // Sends part of a buffer over the socket
+    virtual ssize_t send(int recipient_socket_fd, const char *data,
+                         size_t size) const = 0;
+
+    // Sends several buffers over the socket
+    virtual ssize_t writev(int socket_descriptor, const struct iovec *iov,
+                           int count) const = 0;
+
+    // Sends part of a file over the socket
+    virtual ssize_t sendFile(int socket_descriptor, int file_descriptor,
+                             off_t offset, size_t size) const = 0;
+
     // Sends data over the socket blocking until all data is sent
     virtual int sendAll(int recipient_socket_fd,
                         const std::vector<char> &data) const = 0;
@@ -51,8 +68,15 @@ public:
     virtual ssize_t recv(int socket_descriptor, char *buffer,
                          size_t len) const = 0;
 
+    // Receives data from the socket into several buffers
+    virtual ssize_t readv(int socket_descriptor, const struct iovec *iov,
+                          int count) const = 0;
+
     // Forcibly bind a socket to a port in use
     virtual int setReuseAddr(int fd) const = 0;
+
+    // Share a port between the sockets of several processes
+    virtual int setReusePort(int fd) const = 0;
 };
 
 #endif // ISOCKET_HPP
@@ -20,6 +20,7 @@
 #include "../pollfd/IPollfdManager.hpp"
 #include "IServer.hpp"
 #include "ISocket.hpp"
+#include <vector>
 
 class Server : public IServer
 {
@@ -29,25 +30,50 @@ private:
     IConnectionManager
         &m_connection_manager; // Reference to the ConnectionManager
     ILogger &m_logger;         // Reference to the error logger
+    std::vector<std::pair<int, int> >
+        m_endpoints;              // Unique IP:port combinations to listen on
+    std::vector<int> m_listeners; // Open server socket descriptors
+    int m_max_connections;        // Backlog of the server sockets
+    size_t m_accept_budget; // Maximum connections accepted per readiness
+    std::vector<ClientInfo_t> m_accepted; // Connections accepted in a batch
+    size_t m_high_watermark;   // Clients at which accepting stops
+    size_t m_low_watermark;    // Clients at which accepting resumes
+    size_t m_resume_watermark; // Low watermark, or lower when out of fds
+    bool m_reject_overflow;    // Answer 503 instead of pausing accept
+    bool m_overloaded;         // Not admitting new clients
+    bool m_listeners_paused;   // Server sockets removed from polling
+    std::vector<char> m_overload_response; // Pre-serialised 503 response
 
-    void m_initializeServerSocket(
+    int m_initializeServerSocket(
         int ip, int port,
-        int max_connections); // Method to initialize the server socket
+        bool reuse_port); // Method to initialize the server socket
+    void m_pollListeners(bool enabled); // Method to (un)poll server sockets
+    void m_enterOverload(
+        bool pause_listeners); // Method to stop admitting connections
+    void m_rejectConnection(
+        int client_socket_descriptor); // Method to answer 503 and close
 
 public:
     Server(const ISocket &m_socket, IPollfdManager &pollfd_manager,
            IConnectionManager &connection_manager,
-           IConfiguration &configuration,
-           ILogger &logger); // Constructor for Server class
+           IConfiguration &configuration, ILogger &logger,
+           bool reuse_port = false); // Constructor for Server class
     ~Server();               // Destructor for Server class
 
     virtual void
-    acceptConnection(int server_socket_descriptor); // Method to accept a new
-                                                    // client connection
+    acceptConnection(int server_socket_descriptor); // Method to accept the
+                                                    // pending client
+                                                    // connections
     virtual void
     terminate(int exit_code); // Method to terminate the server Closes file
                               // descriptors, clears memory, writes log buffers
                               // to file, and exits
+
+    virtual void openListeners(
+        bool reuse_port); // Method to open a server socket per endpoint
+    virtual void closeListeners(); // Method to close the server sockets
+    virtual void updateAdmission(); // Method to resume accepting below the
+                                    // low watermark
 };
 
 #endif // SERVER_HPP
@@ -50,6 +50,18 @@ public:
     virtual int send(int recipient_socket_fd,
                      const std::vector<char> &data) const;
 
+    // Sends part of a buffer over the socket
+    virtual ssize_t send(int recipient_socket_fd, const char *data,
+                         size_t size) const;
+
+    // Sends several buffers over the socket
+    virtual ssize_t writev(int socket_descriptor, const struct iovec *iov,
+                           int count) const;
+
+    // Sends part of a file over the socket
+    virtual ssize_t sendFile(int socket_descriptor, int file_descriptor,
+                             off_t offset, size_t size) const;
+
     // Sends data over the socket blocking until all data is sent
     virtual int sendAll(int recipient_socket_fd,
                         const std::vector<char> &data) const;
@@ -57,8 +69,15 @@ public:
     // Receives data from the socket
     virtual ssize_t recv(int socket_descriptor, char *buffer, size_t len) const;
 
+    // Receives data from the socket into several buffers
+    virtual ssize_t readv(int socket_descriptor, const struct iovec *iov,
+                          int count) const;
+
     // Forcibly bind a socket to a port in use
     virtual int setReuseAddr(int fd) const;
+
+    // Share a port between the sockets of several processes
+    virtual int setReusePort(int fd) const;
 };
 
 #endif // SOCKET_HPP
@@ -14,15 +14,49 @@
 
 #include <cstddef>
 #include <poll.h>
+#include <sys/types.h>
+#include <vector>
 
+// Type of a descriptor in the pollfdQueue
 enum DescriptorType
 {
-    REGULAR_FILE = 0x0,
-    SERVER_SOCKET = 0x40,
-    CLIENT_SOCKET = 0x80,
-    PIPE = 0xC0,
+    REGULAR_FILE,
+    SERVER_SOCKET,
+    CLIENT_SOCKET,
+    PIPE,
 };
 
+// Role flags of a descriptor
+#define DESCRIPTOR_BODY_FILE 0x01 // Regular file holding a CGI request body
+
+// Shares of the pollfdQueue, each with its own capacity, so that a burst of
+// clients cannot take the slots CGI requests need (and the other way around)
+enum PollfdCategory
+{
+    CLIENT_SOCKETS, // 'worker_connections'
+    CGI_PIPES,      // 'worker_cgi_processes'
+    BODY_FILES,     // 'worker_cgi_processes'
+    RESERVED,       // Server sockets and log files
+    POLLFD_CATEGORIES,
+};
+
+// Handler invoked by the EventManager for the events of a descriptor
+class EventManager;
+typedef void (EventManager::*DescriptorHandler)(ssize_t &pollfd_index,
+                                                short events);
+
+// Entry of the descriptor table, indexed by file descriptor
+struct DescriptorEntry
+{
+    int slot;                  // Position in the pollfdQueue, -1 when unused
+    DescriptorType type;       // Type of the descriptor
+    unsigned char flags;       // Role flags
+    DescriptorHandler handler; // Handler for the events of the descriptor
+};
+
+// Forward declaration of the polling backend notified about interest changes
+class IPollingService;
+
 class IPollfdManager
 {
 public:
@@ -49,6 +83,18 @@ public:
     // pollfdQueue
     virtual void addPollOut(int position) = 0;
 
+    // Method to remove the POLLOUT event for a specific position in the
+    // pollfdQueue
+    virtual void removePollOut(int position) = 0;
+
+    // Method to replace the requested events at a specific position in the
+    // pollfdQueue
+    virtual void setEvents(int position, short events) = 0;
+
+    // Method to have the polling backend report a descriptor again if it is
+    // still ready (edge-triggered backends only report changes)
+    virtual void rearmDescriptor(int position) = 0;
+
     // Method to close all file descriptors in the pollfdQueue
     virtual void closeAllFileDescriptors() = 0;
 
@@ -58,6 +104,14 @@ public:
     // Method to get the events at a specific position in the pollfdQueue
     virtual short getEvents(int position) = 0;
 
+    // Method to get the descriptor table entry at a specific position in the
+    // pollfdQueue
+    virtual const DescriptorEntry &getDescriptorEntry(int position) = 0;
+
+    // Method to set the handler used for descriptors of a given type
+    virtual void setDescriptorHandler(DescriptorType type,
+                                      DescriptorHandler handler) = 0;
+
     // Method to get the file descriptor at a specific position in the
     // pollfdQueue
     virtual int getDescriptor(int position) = 0;
@@ -65,11 +119,27 @@ public:
     // Method to check if the pollfdQueue has reached its capacity
     virtual bool hasReachedCapacity() const = 0;
 
+    // Methods to get the usage of a share of the pollfdQueue
+    virtual bool hasReachedCapacity(PollfdCategory category) const = 0;
+    virtual size_t getCategorySize(PollfdCategory category) const = 0;
+    virtual size_t getCategoryCapacity(PollfdCategory category) const = 0;
+
     // Method to get a pointer to the pollfd array
     virtual pollfd *getPollfdArray() = 0;
 
     // Method to get the current pollfd queue index given a file descriptor
     virtual int getPollfdQueueIndex(int fd) = 0;
+
+    // Method to get the maximum number of pollfds in the pollfdQueue
+    virtual size_t getPollfdQueueCapacity() const = 0;
+
+    // Method to set the polling backend notified about interest set changes
+    virtual void setPollingService(IPollingService *polling_service) = 0;
+
+    // Methods to maintain the descriptors reported ready by the last poll
+    virtual void addReadyDescriptor(int fd) = 0;
+    virtual const std::vector<int> &getReadyDescriptors() const = 0;
+    virtual void clearReadyDescriptors() = 0;
 };
 
 #endif // IPOLLFDMANAGER_HPP
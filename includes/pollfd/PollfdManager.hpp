@@ -21,7 +21,9 @@
 #include "../configuration/IConfiguration.hpp" // Include the header file for IConfiguration
 #include "IPollfdManager.hpp" // Include the header file for IPollfdManager
 #include "PollfdQueue.hpp"    // Include the header file for PollfdQueue
-#include <map>                // Include the map library
+#include <vector>             // Include the vector library
+
+#define POLLFD_RESERVED_SLOTS 16 // Server sockets and log files
 
 // Forward declaration of Server class
 class IServer;
@@ -31,13 +33,30 @@ class PollfdManager : public IPollfdManager
 {
 private:
     PollfdQueue m_pollfds; // Queue for storing polling file descriptors
-    std::map<int, DescriptorType>
-        m_descriptor_type_map; // Map for storing the type of descriptor
-    ILogger &m_logger;         // Reference to the logger object
-    std::vector<int> m_body_file_descriptors;
+    std::vector<DescriptorEntry>
+        m_descriptor_table; // Table of descriptor entries indexed by fd
+    DescriptorHandler
+        m_descriptor_handlers[ 4 ]; // Handler for each descriptor type
+    ILogger &m_logger;              // Reference to the logger object
+    std::vector<int> m_ready_descriptors; // Descriptors ready after polling
+    IPollingService *m_polling_service;   // Backend notified about changes
+    size_t m_category_sizes[ POLLFD_CATEGORIES ];      // Pollfds per category
+    size_t m_category_capacities[ POLLFD_CATEGORIES ]; // Limit per category
+
+    // Method to get the capacity of a category from the configuration
+    static size_t m_getCategoryCapacity(IConfiguration &configuration,
+                                        PollfdCategory category);
+
+    // Method to get the category of a descriptor
+    static PollfdCategory m_getCategory(DescriptorType type,
+                                        unsigned char flags);
+
+    // Method to get the table entry of a file descriptor, growing the table
+    DescriptorEntry &m_getEntry(int fd);
 
     // Method to add a polling file descriptor
-    virtual void m_addPollfd(pollfd pollFd);
+    virtual void m_addPollfd(pollfd pollFd, DescriptorType type,
+                             unsigned char flags = 0);
 
 public:
     // Constructor for PollfdManager class
@@ -67,6 +86,18 @@ public:
     // PollfdQueue
     virtual void addPollOut(int position);
 
+    // Method to remove the POLLOUT event for a specific position in the
+    // PollfdQueue
+    virtual void removePollOut(int position);
+
+    // Method to replace the requested events at a specific position in the
+    // PollfdQueue
+    virtual void setEvents(int position, short events);
+
+    // Method to have the polling backend report a descriptor again if it is
+    // still ready
+    virtual void rearmDescriptor(int position);
+
     // Method to close all file descriptors in the PollfdQueue
     virtual void closeAllFileDescriptors();
 
@@ -76,6 +107,14 @@ public:
     // Method to get the events at a specific position in the PollfdQueue
     virtual short getEvents(int position);
 
+    // Method to get the descriptor table entry at a specific position in the
+    // PollfdQueue
+    virtual const DescriptorEntry &getDescriptorEntry(int position);
+
+    // Method to set the handler used for descriptors of a given type
+    virtual void setDescriptorHandler(DescriptorType type,
+                                      DescriptorHandler handler);
+
     // Method to get the file descriptor at a specific position in the
     // PollfdQueue
     virtual int getDescriptor(int position);
@@ -83,11 +122,27 @@ public:
     // Method to check if the PollfdQueue has reached its capacity
     virtual bool hasReachedCapacity() const;
 
+    // Methods to get the usage of a share of the PollfdQueue
+    virtual bool hasReachedCapacity(PollfdCategory category) const;
+    virtual size_t getCategorySize(PollfdCategory category) const;
+    virtual size_t getCategoryCapacity(PollfdCategory category) const;
+
     // Method to get a pointer to the pollfd array
     virtual pollfd *getPollfdArray();
 
     // Method to get the current pollfd queue index given a file descriptor
     virtual int getPollfdQueueIndex(int fd);
+
+    // Method to get the maximum number of pollfds in the PollfdQueue
+    virtual size_t getPollfdQueueCapacity() const;
+
+    // Method to set the polling backend notified about interest set changes
+    virtual void setPollingService(IPollingService *polling_service);
+
+    // Methods to maintain the descriptors reported ready by the last poll
+    virtual void addReadyDescriptor(int fd);
+    virtual const std::vector<int> &getReadyDescriptors() const;
+    virtual void clearReadyDescriptors();
 };
 
 #endif // POLLFDMANAGER_HPP
@@ -14,11 +14,14 @@
 
 #include "../constants/HttpHeaderHelper.hpp"
 #include "../constants/HttpMethodHelper.hpp"
+#include "../constants/HttpStatusCodeHelper.hpp"
 #include "../constants/HttpVersionHelper.hpp"
 #include "../response/IRoute.hpp"
+#include "../utils/BufferPool.hpp"
 #include <cstddef>
 #include <map>
 #include <string>
+#include <sys/uio.h>
 #include <vector>
 
 // BodyParameter represents a single part of a multipart/form-data request.
@@ -37,6 +40,283 @@ struct BodyParameter
     std::map<std::string, std::string>
         headers; // All headers of the part; useful
                  // for both files and form fields
+    mutable std::string file_path; // Temporary file holding the data of a
+                                   // file part, in the upload directory;
+                                   // empty once stored under its name
+};
+
+// Outcome of a step of the request processing: OK, or the status code to
+// answer with and the reason to log. Malformed requests are common, their
+// errors are returned rather than thrown.
+struct RequestResult
+{
+    HttpStatusCode status_code;
+    const char *reason; // Static string, NULL if there is none
+
+    RequestResult() : status_code(OK), reason(NULL) {}
+    explicit RequestResult(HttpStatusCode code, const char *why = NULL)
+        : status_code(code), reason(why)
+    {
+    }
+
+    bool ok() const { return status_code == OK; }
+};
+
+// Header fields of a request, in arrival order. The fields of the known
+// headers are indexed by their HttpHeader, so a lookup is a single array
+// access; unknown headers are kept with the name as received, for CGI
+// scripts and proxying. A repeated header is kept once per occurrence, a
+// lookup finds the last one. clear() keeps the storage of the fields for the
+// next request.
+class RequestHeaders
+{
+public:
+    struct Field
+    {
+        HttpHeader header; // HTTP_HEADER_COUNT for an unknown header
+        std::string name;  // As received
+        std::string value;
+    };
+
+private:
+    std::vector<Field> m_fields; // The fields past m_count are spare storage
+    size_t m_count;
+    size_t m_index[ HTTP_HEADER_COUNT ]; // Last field of the header + 1, or 0
+
+public:
+    RequestHeaders();
+
+    void add(HttpHeader header, const std::string &name,
+             const std::string &value);
+
+    // Value of the header, empty when it is missing
+    const std::string &get(HttpHeader header) const;
+    bool has(HttpHeader header) const;
+
+    // Fields in arrival order
+    size_t size() const;
+    const Field &operator[](size_t index) const;
+
+    void clear();
+};
+
+// Body of a request. It is kept in memory up to 'client_body_in_memory_limit'
+// bytes; a larger body is written to a temporary file as it arrives, the
+// memory then stages the writes. The file is unlinked as soon as it is
+// created and closed by clear(), the CGI process reads it as its standard
+// input.
+class RequestBody
+{
+private:
+    std::vector<char> m_data; // Body, or the bytes not written to the file yet
+    int m_file_descriptor;    // Temporary file, -1 while in memory
+    size_t m_size;
+    size_t m_memory_limit;
+    // Name of a file created by create() where unnamed files are not
+    // supported, empty once linked
+    mutable std::string m_file_path;
+
+    RequestResult m_write(const char *data, size_t size);
+
+    // Not copyable, the file belongs to one request
+    RequestBody(const RequestBody &);
+    RequestBody &operator=(const RequestBody &);
+
+public:
+    explicit RequestBody(size_t memory_limit);
+    ~RequestBody();
+
+    RequestResult append(const char *data, size_t size);
+
+    // Write the whole body to the temporary file
+    RequestResult spill();
+
+    // Write the body to a new file of directory instead, with room for
+    // expected_size bytes; the file gets its name from link()
+    RequestResult create(const std::string &directory, size_t expected_size);
+
+    // Give the complete file created by create() the name path, replacing
+    // the file of that name if any; created tells whether there was none
+    bool link(const std::string &path, bool &created) const;
+
+    size_t size() const;
+    bool empty() const;
+    bool isInMemory() const;
+    const std::vector<char> &getData() const; // Whole body while in memory
+    int getFileDescriptor() const;            // -1 while in memory
+
+    // Copy the whole body, from the file if it was spilled
+    bool read(std::string &body) const;
+
+    // Forget the body; the memory storage is kept up to kept_capacity bytes
+    void clear(size_t kept_capacity);
+};
+
+// Bytes received on a connection and not parsed yet, in chunks of a
+// BufferPool. The socket is read straight into the chunks: prepare() offers
+// their free space, commit() adds the bytes read. The parser reads the first
+// chunk in place, and consume() gives the chunks it is done with back to the
+// pool.
+class RequestBuffer
+{
+private:
+    struct Chunk
+    {
+        char *data;
+        size_t begin; // First unparsed byte
+        size_t end;   // End of the received bytes
+    };
+
+    BufferPool &m_pool;
+    std::vector<Chunk> m_chunks;    // In arrival order, none empty
+    std::vector<char *> m_reserved; // New chunks offered by prepare()
+    size_t m_size;                  // Unparsed bytes of all the chunks
+
+    // Not copyable, the chunks belong to one connection
+    RequestBuffer(const RequestBuffer &);
+    RequestBuffer &operator=(const RequestBuffer &);
+
+public:
+    explicit RequestBuffer(BufferPool &pool);
+    ~RequestBuffer();
+
+    // Point up to count iovec at free space: the end of the last chunk,
+    // then new chunks; returns the number of iovec used
+    size_t prepare(struct iovec *iov, size_t count);
+    // Add the size bytes read into the space offered by prepare()
+    void commit(size_t size);
+
+    // Unparsed bytes of the first chunk
+    const char *data() const;
+    size_t size() const;
+    // Unparsed bytes of all the chunks
+    size_t total() const;
+    bool empty() const;
+
+    // Move bytes of the second chunk behind the bytes of the first one, for
+    // a request head received across them; false when there is no second
+    // chunk or no room in the first one
+    bool join();
+
+    // Mark size bytes parsed
+    void consume(size_t size);
+    void clear();
+
+    BufferPool &getPool() const;
+};
+
+// Position of a token of the request head in the request buffer
+struct RequestToken
+{
+    size_t offset;
+    size_t length;
+};
+
+// A header field of the request head
+struct RequestHeaderField
+{
+    RequestToken name;
+    RequestToken value;
+};
+
+// Position of the head parser in the request head
+enum HeadPhase
+{
+    HEAD_START,       // Empty lines before the request line
+    HEAD_METHOD,      // Request line
+    HEAD_URI,         //
+    HEAD_VERSION,     //
+    HEAD_VERSION_LF,  // CR after the version seen
+    HEAD_FIELD_START, // Start of a header field, or of the empty line
+    HEAD_NAME,        // Header field
+    HEAD_VALUE_START, //
+    HEAD_VALUE,       //
+    HEAD_VALUE_LF,    // CR after the value seen
+    HEAD_END_LF,      // CR of the empty line seen
+    HEAD_DONE,
+};
+
+// Progress of the head parser, kept between two reads: the bytes received
+// are scanned once, and the tokens are recorded as offsets into the request
+// buffer (see RequestParser::scanHead)
+struct RequestHead
+{
+    HeadPhase phase;
+    size_t scan_offset; // Next byte to scan
+    size_t token_start; // Start of the token being scanned
+    RequestToken method;
+    RequestToken uri;
+    RequestToken http_version;
+    std::vector<RequestHeaderField> fields;
+
+    RequestHead();
+    void reset();
+};
+
+// Position of the chunked body decoder in the chunked body
+enum ChunkPhase
+{
+    CHUNK_SIZE,          // Chunk size line
+    CHUNK_EXTENSION,     //
+    CHUNK_SIZE_LF,       // CR after the size line seen
+    CHUNK_DATA,          // Chunk data
+    CHUNK_DATA_CR,       //
+    CHUNK_DATA_LF,       // CR after the data seen
+    CHUNK_TRAILER,       // Start of a trailer field, or of the empty line
+    CHUNK_TRAILER_FIELD, // Trailer field
+    CHUNK_TRAILER_LF,    // CR after the field seen
+    CHUNK_END_LF,        // CR of the empty line seen
+    CHUNK_DONE,
+};
+
+// Progress of the chunked body decoder, kept between two reads: the decoded
+// bytes are appended to the body and removed from the request buffer (see
+// RequestParser::m_unchunkBody)
+struct RequestChunk
+{
+    ChunkPhase phase;
+    size_t remaining;   // Size of the chunk, then data bytes still to come
+    size_t line_length; // Bytes of the size line or trailer field so far
+    size_t decoded;     // Body bytes decoded so far
+
+    RequestChunk();
+    void reset();
+};
+
+// Position of the multipart parser in a multipart/form-data body
+enum MultipartPhase
+{
+    MULTIPART_OFF,            // Not a multipart upload
+    MULTIPART_PREAMBLE,       // Before the first delimiter
+    MULTIPART_DELIMITER_END,  // Delimiter seen
+    MULTIPART_DELIMITER_LF,   //
+    MULTIPART_CLOSE_DASH,     // First '-' of the close delimiter seen
+    MULTIPART_HEADERS,        // Part header fields
+    MULTIPART_DATA,           // Part data
+    MULTIPART_EPILOGUE,       // After the close delimiter
+};
+
+// Progress of the multipart parser, kept between two reads: the data of a
+// file part is written to its file as it arrives, only the bytes that may
+// start a delimiter are held back (see RequestParser::m_parseMultipart)
+struct RequestMultipart
+{
+    MultipartPhase phase;
+    std::string delimiter;  // CRLF "--" boundary
+    size_t skip[ 256 ];     // Boyer-Moore-Horspool shifts of the delimiter
+    std::string tail;       // Bytes that may start a delimiter
+    std::string line;       // Part header field being received
+    std::string directory;  // Where the file parts are written
+    BodyParameter part;     // Part being received
+    int file_descriptor;    // File of the part, -1 for a form field
+
+    RequestMultipart();
+    ~RequestMultipart();
+    void reset(); // Deletes the file of an incomplete part
+
+private:
+    RequestMultipart(const RequestMultipart &);
+    RequestMultipart &operator=(const RequestMultipart &);
 };
 
 class RequestState
@@ -48,6 +328,10 @@ private:
     bool m_headers;
     bool m_finished;
     IRoute *m_route;
+    IResponseGenerator *m_response_generator;
+    RequestHead m_head;
+    RequestChunk m_chunk;
+    RequestMultipart m_multipart;
 
 public:
     RequestState();
@@ -57,6 +341,10 @@ public:
     int getContentRed(void) const;
     int getContentLength(void) const;
     IRoute *getRoute(void) const;
+    IResponseGenerator *getResponseGenerator(void) const;
+    RequestHead &getHead(void);
+    RequestChunk &getChunk(void);
+    RequestMultipart &getMultipart(void);
 
     void finished(bool value);
     void headers(bool value);
@@ -66,6 +354,7 @@ public:
     void setContentLength(int value);
     void reset(void);
     void setRoute(IRoute *route);
+    void setResponseGenerator(IResponseGenerator *response_generator);
 };
 
 class IRequest
@@ -76,16 +365,15 @@ public:
     // Getters
     virtual HttpMethod getMethod() const = 0;
     virtual std::string getMethodString() const = 0;
-    virtual std::string getUri() const = 0;
+    virtual const std::string &getUri() const = 0;
     virtual HttpVersion getHttpVersion() const = 0;
     virtual std::string getHttpVersionString() const = 0;
-    virtual const std::map<HttpHeader, std::string> getHeaders() const = 0;
-    virtual std::string getHeaderValue(HttpHeader header) const = 0;
-    virtual std::map<std::string, std::string> getHeadersStringMap() const = 0;
+    virtual const RequestHeaders &getHeaders() const = 0;
+    virtual const std::string &getHeaderValue(HttpHeader header) const = 0;
     virtual std::map<std::string, std::string> getQueryParameters() const = 0;
     virtual std::map<std::string, std::string> getCookies() const = 0;
     virtual std::string getCookie(const std::string &) const = 0;
-    virtual const std::vector<char> getBody() const = 0;
+    virtual const RequestBody &getBody() const = 0;
     virtual std::string getBodyString() const = 0;
     virtual std::string getQueryString() const = 0;
     virtual std::string getContentLength() const = 0;
@@ -97,30 +385,32 @@ public:
     virtual std::string getAuthority() const = 0;
     virtual const std::vector<BodyParameter> &getBodyParameters() const = 0;
     virtual bool isUploadRequest() const = 0;
+    virtual bool storeBodyParameter(size_t index,
+                                    const std::string &path) const = 0;
     virtual RequestState &getState(void) = 0;
-    virtual std::vector<char> &getBody(void) = 0;
-    virtual std::string getBodyFilePath() const = 0;
-    virtual const std::vector<char> &getBuffer() const = 0;
+    virtual RequestBody &getBody(void) = 0;
+    virtual const RequestBuffer &getBuffer() const = 0;
+    virtual RequestBuffer &getBuffer() = 0;
 
     // Setters
-    virtual void setMethod(const std::string &method) = 0;
-    virtual void setUri(const std::string &uri) = 0;
-    virtual void setHttpVersion(const std::string &http_version) = 0;
-    virtual void addHeader(const std::string &key,
-                           const std::string &value) = 0;
-    virtual void setBody(const std::vector<char> &body) = 0;
-    virtual void setBody(const std::string &body) = 0;
+    virtual RequestResult setMethod(const std::string &method) = 0;
+    virtual RequestResult setUri(const std::string &uri) = 0;
+    virtual RequestResult setHttpVersion(const std::string &http_version) = 0;
+    virtual RequestResult addHeader(const std::string &key,
+                                    const std::string &value) = 0;
+    virtual RequestResult setBody(const std::vector<char> &body) = 0;
+    virtual RequestResult setBody(const std::string &body) = 0;
     virtual void addCookie(const std::string &key,
                            const std::string &value) = 0;
-    virtual void setAuthority() = 0;
+    virtual RequestResult setAuthority() = 0;
     virtual void addBodyParameter(const BodyParameter &body_parameter) = 0;
     virtual void setUploadRequest(bool upload_request) = 0;
-    virtual void appendBody(std::vector<char>::const_iterator begin,
-                            std::vector<char>::const_iterator end) = 0;
-    virtual void appendBuffer(const std::vector<char> &raw_request) = 0;
+    virtual RequestResult appendBody(const char *data, size_t size) = 0;
     virtual void clearBuffer() = 0;
     virtual void trimBuffer(ptrdiff_t) = 0;
-    virtual void setBodyFilePath(const std::string &body_file_path) = 0;
+
+    // Clear the request for the next one on a persistent connection
+    virtual void reset() = 0;
 };
 
 #endif // IREQUEST_HPP
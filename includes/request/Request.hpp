@@ -9,8 +9,8 @@
  * provides getter and setter methods to access and modify these components,
  * following the HTTP protocol specifications.
  *
- * It takes responsability to verifying the validity of its components and
- * throws exceptions if any component is invalid.
+ * It takes responsability to verifying the validity of its components; the
+ * setters return the status code to answer with if a component is invalid.
  *
  * Instances of this class are typically created by the RequestParser class,
  * which parses raw HTTP request strings and constructs Request objects from
@@ -29,18 +29,20 @@
  * NOTE: for string representations use the string getters where available:
  * request.getMethodString(); // Get the request method as a string
  * request.getHttpVersionString(); // Get the HTTP version as a string
- * request.getHeadersStrings(); // Get the request headers as a string-keyed map
  *
  */
 
 #include "../configuration/IConfiguration.hpp"
 #include "../constants/HttpHelper.hpp"
+#include "../utils/Arena.hpp"
 #include "IRequest.hpp"
 #include <cstddef>
 #include <map>
 #include <string>
 #include <vector>
 
+#define REQUEST_KEPT_CAPACITY 65536 // Body storage kept by reset(), in bytes
+
 class Request : public IRequest
 {
 private:
@@ -50,21 +52,21 @@ private:
     HttpVersion m_http_version;
 
     // Request headers
-    std::map<HttpHeader, std::string> m_headers;
+    RequestHeaders m_headers;
 
     // Request body
-    std::vector<char> m_body;
+    RequestBody m_body;
 
-    // Request buffer - used to store incomplete headers & chunks
-    std::vector<char> m_buffer;
+    // Bytes received and not parsed yet, in chunks of the worker's pool
+    RequestBuffer m_buffer;
 
     // Included Request parameters
     std::string m_host_name;
     std::string m_host_port;
     std::string m_authority;
-    std::map<std::string, std::string> m_query_parameters;
+    ArenaStringMap m_query_parameters;
     std::pair<std::string, std::string> m_remote_address;
-    std::map<std::string, std::string> m_cookies;
+    ArenaStringMap m_cookies;
     std::vector<BodyParameter> m_body_parameters;
     bool m_upload_request;
     std::string m_request_id;
@@ -75,12 +77,12 @@ private:
     const HttpHelper &m_http_helper;
     RequestState m_state;
 
-    // Body File Path
-    std::string m_body_file_path;
+    void m_removeUploadFiles();
 
 public:
     // Constructor and Destructor
-    Request(const IConfiguration &configuration, const HttpHelper &http_helper);
+    Request(const IConfiguration &configuration, const HttpHelper &http_helper,
+            Arena &arena, BufferPool &buffer_pool);
     Request(const Request &src);
     ~Request();
 
@@ -90,17 +92,16 @@ public:
     // Getters
     HttpMethod getMethod() const;
     std::string getMethodString() const;
-    std::string getUri() const;
+    const std::string &getUri() const;
     HttpVersion getHttpVersion() const;
     std::string getHttpVersionString() const;
-    const std::map<HttpHeader, std::string> getHeaders() const;
-    std::string getHeaderValue(HttpHeader header) const;
-    std::map<std::string, std::string> getHeadersStringMap() const;
+    const RequestHeaders &getHeaders() const;
+    const std::string &getHeaderValue(HttpHeader header) const;
     std::map<std::string, std::string> getQueryParameters() const;
     std::map<std::string, std::string> getCookies() const;
     std::string getCookie(const std::string &key) const;
-    const std::vector<char> getBody() const;
-    std::vector<char> &getBody(void);
+    const RequestBody &getBody() const;
+    RequestBody &getBody(void);
     std::string getBodyString() const;
     std::string getQueryString() const;
     std::string getContentLength() const;
@@ -112,28 +113,28 @@ public:
     std::string getAuthority() const;
     const std::vector<BodyParameter> &getBodyParameters() const;
     bool isUploadRequest() const;
+    bool storeBodyParameter(size_t index, const std::string &path) const;
     RequestState &getState(void);
-    const std::vector<char> &getBuffer() const;
-    std::string getBodyFilePath() const;
+    const RequestBuffer &getBuffer() const;
+    RequestBuffer &getBuffer();
 
     // Setters
-    void setMethod(const std::string &method);
-    void setUri(const std::string &uri);
-    void setHttpVersion(const std::string &http_version);
-    void addHeader(const std::string &key, const std::string &value);
-    void setBody(const std::vector<char> &body);
-    void setBody(const std::string &body);
-    void addBodyChar(char value);
+    RequestResult setMethod(const std::string &method);
+    RequestResult setUri(const std::string &uri);
+    RequestResult setHttpVersion(const std::string &http_version);
+    RequestResult addHeader(const std::string &key, const std::string &value);
+    RequestResult setBody(const std::vector<char> &body);
+    RequestResult setBody(const std::string &body);
     void addCookie(const std::string &key, const std::string &value);
-    void setAuthority();
+    RequestResult setAuthority();
     void addBodyParameter(const BodyParameter &body_parameter);
     void setUploadRequest(bool upload_request);
-    virtual void appendBody(std::vector<char>::const_iterator start,
-                            std::vector<char>::const_iterator end);
-    void appendBuffer(const std::vector<char> &raw_request);
+    RequestResult appendBody(const char *data, size_t size);
     void clearBuffer(void);
     void trimBuffer(ptrdiff_t new_start);
-    void setBodyFilePath(const std::string &body_file_path);
+
+    // Clear the request for the next one on a persistent connection
+    void reset();
 };
 
 #endif // REQUEST_HPP
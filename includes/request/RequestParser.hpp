@@ -7,6 +7,27 @@
  * The RequestParser class provides functionality for parsing raw HTTP requests
  * and converting them into IRequest objects.
  *
+ * The head of a request is scanned as it arrives by scanHead(), which keeps
+ * its progress in the RequestState: every byte is looked at once, however
+ * slowly the client sends it; the bytes of a token are checked 16 or 32 at a
+ * time by the ByteScanner kernels. Once the head is complete, parseRequest()
+ * sets the request fields from the recorded offsets; the body is parsed
+ * once the request is routed, from startBody(). A chunked body is decoded
+ * the same way: the decoder keeps its position in the RequestState, so each
+ * byte is decoded once, whatever the chunk sizes.
+ *
+ * The bytes are parsed in place in the chunks of the RequestBuffer, the
+ * first chunk at a time. A head received across two chunks is joined in the
+ * first one, so a head has to fit in receive_chunk_size bytes (431).
+ *
+ * A multipart/form-data body of an upload is parsed as it is decoded: the
+ * delimiters are found with Boyer-Moore-Horspool, the file parts are written
+ * to the upload directory as they arrive. A PUT body goes to a new file next
+ * to its target, without a name until it is complete.
+ *
+ * Malformed requests are answered with the status code in the RequestResult
+ * the functions return; nothing is thrown for them.
+ *
  */
 
 #include "../configuration/IConfiguration.hpp"
@@ -22,75 +43,74 @@ private:
     const IConfiguration
         &m_configuration; // Reference to the server IConfiguration
 
-    // Function to parse the request line of an HTTP request
-    void m_parseRequestLine(std::vector<char>::const_iterator &it,
-                            const std::vector<char> &raw_request,
-                            IRequest &parsed_request) const;
-
-    // Functions to parse the components of the request line
-    std::string m_parseMethod(std::vector<char>::const_iterator &it,
-                              const std::vector<char> &raw_request) const;
-    std::string m_parseUri(std::vector<char>::const_iterator &it,
-                           const std::vector<char> &raw_request) const;
-    std::string m_parseHttpVersion(std::vector<char>::const_iterator &it,
-                                   const std::vector<char> &raw_request) const;
-
-    // Function to parse the headers of an HTTP request
-    void m_parseHeaders(std::vector<char>::const_iterator &it,
-                        const std::vector<char> &raw_request,
-                        IRequest &parsed_request) const;
-
-    // Function to parse an individual header
-    void m_parseHeader(std::vector<char>::const_iterator &it,
-                       const std::vector<char> &raw_request,
-                       IRequest &parsed_request) const;
-
-    // Function to unchunk the body of an HTTP request
-    void m_unchunkBody(const std::vector<char> &raw_request,
-                       IRequest &request) const;
+    // Function to scan the request head in the first chunk of the buffer
+    RequestResult m_scanHeadChunk(IRequest &request) const;
+
+    // Function to skip the bytes of the token being received
+    size_t m_skipToken(HeadPhase phase, const char *data, size_t size) const;
+
+    // Function to record a token of the request head
+    void m_endToken(RequestHead &head, RequestToken &token,
+                    size_t offset) const;
+
+    // Function to set the request line of an HTTP request
+    RequestResult m_setRequestLine(const RequestHead &head,
+                                   const char *raw_request,
+                                   IRequest &parsed_request) const;
+
+    // Function to add an individual header
+    RequestResult m_addHeader(const RequestHeaderField &field,
+                              const char *raw_request,
+                              IRequest &parsed_request) const;
+
+    // Function to parse the body bytes of the first chunk of the buffer
+    RequestResult m_parseBodyChunk(IRequest &parsed_request) const;
+
+    // Function to decode the chunked body received so far
+    RequestResult m_unchunkBody(IRequest &request) const;
+
+    // Functions to pass decoded body bytes on, and to end the body
+    RequestResult m_consumeBody(IRequest &request, const char *data,
+                                size_t size) const;
+    RequestResult m_endBody(IRequest &request) const;
+
+    // Functions to parse a multipart/form-data body as it arrives
+    RequestResult m_startMultipart(IRequest &request,
+                                   const std::string &directory) const;
+    RequestResult m_parseMultipart(IRequest &request, const char *data,
+                                   size_t size) const;
+    size_t m_findPartEnd(IRequest &request, const char *data, size_t size,
+                         bool &found, RequestResult &result) const;
+    RequestResult m_startPart(IRequest &request) const;
+    RequestResult m_writePart(IRequest &request, const char *data,
+                              size_t size) const;
+    void m_endPart(IRequest &request) const;
+    void m_addPartHeader(const std::string &line,
+                         BodyParameter &body_parameter) const;
 
     // Function to parse a Cookie header
     void m_parseCookie(std::string &cookie_header_value,
                        IRequest &parsed_request) const;
 
-    // Function to check if a character is whitespace
-    bool m_isWhitespace(char c) const;
-
-    // Function to check if an iterator points to CRLF (carriage return + line
-    // feed)
-    bool m_isCRLF(std::vector<char>::const_iterator it) const;
-
-    // Function to check if an iterator points to a character that is in a given
-    // set
-    bool m_isCharInSet(std::vector<char>::const_iterator it,
-                       const std::string &set) const;
-
     // Function to trim leading and trailing whitespace from a string
     std::string m_trimWhitespace(const std::string &string) const;
 
     // Function to remove quotes from a string
     void m_removeQuotes(std::string &string) const;
 
-    // Custom getline function to remove carriage returns
-    std::istream &m_getlineNoCr(std::istream &is, std::string &line) const;
-
-    // Function to read a stringstream into a char vector until the boundary is
-    // found
-    void m_assignUntilBoundary(std::istringstream &iss,
-                               const std::string &boundary,
-                               std::vector<char> &dest) const;
-
 public:
     // Constructor to initialize the RequestParser with required references
     RequestParser(const IConfiguration &configuration, ILogger &logger);
 
+    // Function to scan the request buffer for a complete request head
+    RequestResult scanHead(IRequest &request, bool &complete) const;
     // Function to parse a raw HTTP request and convert it into a IRequest
-    // object
-    void parseRequest(IRequest &request) const;
+    // object, once its head is complete
+    RequestResult parseRequest(IRequest &request) const;
+    // Function to start parsing the body, once the route is known
+    RequestResult startBody(IRequest &request, const IRoute &route) const;
     // Function to parse the body of an HTTP request
-    void parseBody(IRequest &parsed_request) const;
-    // Function to parse the Upload Chunked Body
-    void parseBodyParameters(IRequest &parsed_request) const;
+    RequestResult parseBody(IRequest &parsed_request) const;
 };
 
 #endif // REQUESTPARSER_HPP
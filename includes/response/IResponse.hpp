@@ -9,6 +9,7 @@
  *
  */
 
+#include "../buffer/SharedBuffer.hpp"
 #include "../constants/HttpHeaderHelper.hpp"
 #include "../constants/HttpStatusCodeHelper.hpp"
 #include <map>
@@ -24,6 +25,7 @@ public:
     virtual std::string getHeaders() const = 0;
     virtual std::string getBodyString() const = 0;
     virtual std::vector<char> getBody() const = 0;
+    virtual size_t getBodySize() const = 0;
     virtual std::vector<char> &getBuffer() = 0;
 
     // Setters for status line, headers, and body
@@ -38,6 +40,7 @@ public:
     virtual void addCookieHeaders() = 0;
     virtual void setBody(std::string body) = 0;
     virtual void setBody(std::vector<char> body) = 0;
+    virtual void setBodyFile(int file_descriptor, size_t size) = 0;
 
     // Set error response with appropriate status code
     virtual void setErrorResponse(HttpStatusCode status_code) = 0;
@@ -55,13 +58,22 @@ public:
     virtual size_t getResponseSize() const = 0;
     virtual std::map<std::string, std::string> getCookies() const = 0;
     virtual std::string getCookie(const std::string &key) const = 0;
+    virtual bool hasHeader(const std::string &header) const = 0;
 
     // Convert headers to map or string
     virtual std::map<std::string, std::string> getHeadersStringMap() const = 0;
-    virtual std::vector<char> serialise() = 0;
+    virtual std::string serialiseHead() = 0;
+
+    // Take the body out of the response, to send it without a copy: the
+    // bytes, or the file descriptor (-1 if the body is not a file)
+    virtual SharedBuffer releaseBody() = 0;
+    virtual int releaseBodyFile() = 0;
 
     // Append data to the buffer
     virtual void appendBuffer(std::vector<char> &data) = 0;
+
+    // Clear the response for the next request on a persistent connection
+    virtual void reset() = 0;
 };
 
 #endif // IRESPONSE_HPP
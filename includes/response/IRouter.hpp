@@ -16,9 +16,12 @@ class IRouter
 public:
     virtual ~IRouter() {};
 
-    virtual Triplet_t execRoute(IRoute *route, IRequest *req,
-                                IResponse *res) = 0;
-    virtual IRoute *getRoute(IRequest *req, IResponse *res) = 0;
+    virtual Triplet_t execRoute(IRoute *route,
+                                IResponseGenerator *response_generator,
+                                IRequest *req, IResponse *res) = 0;
+    virtual RequestResult getRoute(IRequest *req, IResponse *res,
+                                   IRoute *&route,
+                                   IResponseGenerator *&response_generator) = 0;
 };
 
 #endif // IROUTER_HPP
@@ -0,0 +1,30 @@
+#ifndef PUTRESPONSEGENERATOR_HPP
+#define PUTRESPONSEGENERATOR_HPP
+
+#include "../logger/ILogger.hpp"
+#include "IResponseGenerator.hpp"
+
+/*
+ * PutResponseGenerator
+ *
+ * Stores the body of a PUT request as the file of its URI. The body was
+ * written next to it while it arrived (see RequestBody::create()); the file
+ * is only given its name here, so it replaces the previous one at once.
+ * Answers 201 when the file is new, 204 when it was replaced.
+ */
+
+class PutResponseGenerator : public IResponseGenerator
+{
+private:
+    ILogger &m_logger;
+
+public:
+    PutResponseGenerator(ILogger &logger);
+    ~PutResponseGenerator();
+    Triplet_t generateResponse(const IRoute &route, const IRequest &request,
+                               IResponse &response,
+                               IConfiguration &configuration);
+};
+
+#endif // PUTRESPONSEGENERATOR_HPP
+// Path: includes/response/PutResponseGenerator.hpp
@@ -15,7 +15,6 @@ class RFCCgiResponseGenerator : public IResponseGenerator
 {
 private:
     ILogger &m_logger;
-    HttpStatusCodeHelper m_http_status_code_helper;
     const std::string &m_bin_path;
     bool m_from_file;
 
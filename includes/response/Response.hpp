@@ -10,16 +10,19 @@
  */
 
 #include "../../includes/constants/HttpHelper.hpp"
+#include "../utils/Arena.hpp"
 #include "IResponse.hpp"
 
+#define RESPONSE_KEPT_CAPACITY 65536 // Storage kept by reset(), in bytes
+
 class Response : public IResponse
 {
 private:
     // Response Status line
     std::string m_status_line;
 
-    // Response headers
-    std::map<std::string, std::string> m_headers;
+    // Response headers, in the arena of the connection
+    ArenaStringMap m_headers;
 
     // Response body
     std::vector<char> m_body;
@@ -27,8 +30,12 @@ private:
     // Body size
     size_t m_content_length;
 
+    // File sent as the body instead of m_body, and its size
+    int m_body_file;
+    size_t m_body_file_size;
+
     // Response Cookies
-    std::map<std::string, std::string> m_cookies;
+    ArenaStringMap m_cookies;
 
     // Helper
     const HttpHelper &m_http_helper;
@@ -36,8 +43,11 @@ private:
     // Response buffer - used to store incomplete cgi responses
     std::vector<char> m_buffer;
 
+    size_t m_getHeadersSize() const;
+    void m_closeBodyFile();
+
 public:
-    Response(const HttpHelper &http_helper);
+    Response(const HttpHelper &http_helper, Arena &arena);
     ~Response();
 
     // Getters for status line, headers, body, and buffer
@@ -45,6 +55,7 @@ public:
     virtual std::string getHeaders() const;
     virtual std::string getBodyString() const;
     virtual std::vector<char> getBody() const;
+    virtual size_t getBodySize() const;
     virtual std::vector<char> &getBuffer();
 
     // Setters for status line, headers, and body
@@ -59,6 +70,7 @@ public:
     virtual void addCookieHeaders();
     virtual void setBody(std::string body);
     virtual void setBody(std::vector<char> body);
+    virtual void setBodyFile(int file_descriptor, size_t size);
 
     // Set error response with appropriate status code
     virtual void setErrorResponse(HttpStatusCode status_code);
@@ -76,13 +88,21 @@ public:
     virtual size_t getResponseSize() const;
     virtual std::map<std::string, std::string> getCookies() const;
     virtual std::string getCookie(const std::string &key) const;
+    virtual bool hasHeader(const std::string &header) const;
 
     // Convert headers to map or string
     virtual std::map<std::string, std::string> getHeadersStringMap() const;
-    virtual std::vector<char> serialise();
+    virtual std::string serialiseHead();
+
+    // Take the body out of the response
+    virtual SharedBuffer releaseBody();
+    virtual int releaseBodyFile();
 
     // Append data to the buffer
     virtual void appendBuffer(std::vector<char> &data);
+
+    // Clear the response for the next request on a persistent connection
+    virtual void reset();
 };
 
 #endif // RESPONSE_HPP
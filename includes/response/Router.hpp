@@ -23,7 +23,7 @@ class Router : public IRouter
 private:
     IConfiguration &m_configuration;
     ILogger &m_logger;
-    HttpHelper m_http_helper;
+    const HttpHelper &m_http_helper;
 
     // std::vector<IRoute *>			m_routes;
     std::vector<std::vector<IRoute *> *> m_routes;
@@ -39,11 +39,16 @@ private:
     void m_createRoutes(IConfiguration &server, std::vector<IRoute *> &routes);
 
 public:
-    Router(IConfiguration &Configuration, ILogger &logger);
+    Router(IConfiguration &Configuration, const HttpHelper &http_helper,
+           ILogger &logger);
     ~Router();
 
-    virtual IRoute *getRoute(IRequest *req, IResponse *res);
-    virtual Triplet_t execRoute(IRoute *route, IRequest *req, IResponse *res);
+    virtual RequestResult getRoute(IRequest *req, IResponse *res,
+                                   IRoute *&route,
+                                   IResponseGenerator *&response_generator);
+    virtual Triplet_t execRoute(IRoute *route,
+                                IResponseGenerator *response_generator,
+                                IRequest *req, IResponse *res);
 };
 
 #endif // Router_HPP
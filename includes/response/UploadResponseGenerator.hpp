@@ -13,9 +13,10 @@ class UploadResponseGenerator : public IResponseGenerator
 {
 private:
     ILogger &m_logger;
+    IConfiguration &m_types; // types block, resolved before the threads start
 
 public:
-    UploadResponseGenerator(ILogger &logger);
+    UploadResponseGenerator(ILogger &logger, IConfiguration &configuration);
     ~UploadResponseGenerator();
     Triplet_t generateResponse(const IRoute &route, const IRequest &request,
                                IResponse &response,
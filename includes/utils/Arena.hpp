@@ -0,0 +1,138 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+/*
+ * Arena
+ *
+ * Bump allocator for the data of one request. Allocations are carved out of
+ * blocks of 'request_pool_size' bytes and are never freed one by one:
+ * reset() releases all of them at once, when the connection is recycled for
+ * the next request. The first block is kept, so a connection serving small
+ * requests stops allocating after its first request. An allocation larger
+ * than a block gets a block of its own.
+ *
+ * ArenaAllocator plugs an arena into the standard containers. The container
+ * has to be cleared before the arena is reset.
+ *
+ * Example:
+ * Arena arena(4096);
+ * std::map<int, int, std::less<int>,
+ *          ArenaAllocator<std::pair<const int, int> > >
+ *     map(std::less<int>(), ArenaAllocator<std::pair<const int, int> >(arena));
+ * map[ 1 ] = 2; // the node is in the arena
+ * map.clear();
+ * arena.reset();
+ */
+
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <new>
+#include <string>
+
+class Arena
+{
+private:
+    // Blocks are chained in allocation order, the data follows the header
+    struct Block
+    {
+        Block *next;
+        size_t size;
+    };
+
+    const size_t m_block_size;
+    Block *m_first;   // Kept by reset()
+    Block *m_current; // Block allocations are carved from
+    char *m_position; // Free space of the current block
+    char *m_end;
+
+    Block *m_newBlock(size_t size);
+    void m_use(Block *block);
+
+    // Not copyable, the containers point to it
+    Arena(const Arena &);
+    Arena &operator=(const Arena &);
+
+public:
+    explicit Arena(size_t block_size);
+    ~Arena();
+
+    // Allocate size bytes, aligned for any type
+    void *allocate(size_t size);
+
+    // Release all allocations, keep the first block
+    void reset();
+
+    // Number of blocks held, for statistics
+    size_t getBlockCount() const;
+};
+
+// Standard allocator drawing from an Arena; deallocate() does nothing
+template <typename T> class ArenaAllocator
+{
+private:
+    Arena *m_arena;
+
+public:
+    typedef T value_type;
+    typedef T *pointer;
+    typedef const T *const_pointer;
+    typedef T &reference;
+    typedef const T &const_reference;
+    typedef size_t size_type;
+    typedef ptrdiff_t difference_type;
+
+    template <typename U> struct rebind
+    {
+        typedef ArenaAllocator<U> other;
+    };
+
+    explicit ArenaAllocator(Arena &arena) : m_arena(&arena) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U> &other) : m_arena(other.getArena())
+    {
+    }
+
+    Arena *getArena() const { return m_arena; }
+
+    pointer address(reference value) const { return &value; }
+    const_pointer address(const_reference value) const { return &value; }
+
+    pointer allocate(size_type count, const void * = 0)
+    {
+        if (count > this->max_size())
+            throw std::bad_alloc();
+        return static_cast<pointer>(m_arena->allocate(count * sizeof(T)));
+    }
+
+    void deallocate(pointer, size_type) {}
+
+    size_type max_size() const
+    {
+        return std::numeric_limits<size_type>::max() / sizeof(T);
+    }
+
+    void construct(pointer p, const T &value) { new (p) T(value); }
+    void destroy(pointer p) { p->~T(); }
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T> &lhs, const ArenaAllocator<U> &rhs)
+{
+    return lhs.getArena() == rhs.getArena();
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T> &lhs, const ArenaAllocator<U> &rhs)
+{
+    return lhs.getArena() != rhs.getArena();
+}
+
+// String map with its nodes in an arena
+typedef std::map<std::string, std::string, std::less<std::string>,
+                 ArenaAllocator<std::pair<const std::string, std::string> > >
+    ArenaStringMap;
+
+#endif // ARENA_HPP
+// Path: includes/utils/Arena.hpp
@@ -0,0 +1,47 @@
+#ifndef BUFFERPOOL_HPP
+#define BUFFERPOOL_HPP
+
+/*
+ * BufferPool
+ *
+ * Free list of the fixed size chunks the connections receive into (see
+ * RequestBuffer). A chunk goes back to the pool as soon as its bytes are
+ * parsed, so an idle connection holds none, and a worker serving the same
+ * load stops allocating once the pool holds enough chunks. Up to 'capacity'
+ * free chunks are kept, the others are deleted.
+ *
+ * A pool belongs to one worker thread, like the Factory that owns it.
+ *
+ * Example:
+ * BufferPool pool(16384, 256);
+ * char *chunk = pool.acquire(); // pool.getChunkSize() bytes
+ * pool.release(chunk);          // kept for the next acquire()
+ */
+
+#include <cstddef>
+#include <vector>
+
+class BufferPool
+{
+private:
+    const size_t m_chunk_size;
+    const size_t m_capacity; // Free chunks kept
+    std::vector<char *> m_free;
+
+    // Not copyable, the buffers point to it
+    BufferPool(const BufferPool &);
+    BufferPool &operator=(const BufferPool &);
+
+public:
+    BufferPool(size_t chunk_size, size_t capacity);
+    ~BufferPool();
+
+    char *acquire();
+    void release(char *chunk);
+
+    size_t getChunkSize() const;
+    size_t getFreeCount() const;
+};
+
+#endif // BUFFERPOOL_HPP
+// Path: includes/utils/BufferPool.hpp
@@ -0,0 +1,46 @@
+#ifndef BYTESCANNER_HPP
+#define BYTESCANNER_HPP
+
+/*
+ * ByteScanner
+ *
+ * Delimiter search and byte class validation for the request parser, 16 or
+ * 32 bytes at a time. Every function returns the offset of the first byte it
+ * looks for, or size when there is none, so the caller handles that byte and
+ * resumes after it.
+ *
+ * The kernels are picked once, when the program starts: AVX2 when the CPU
+ * has it, SSE2 on the other x86 CPUs, 8-byte words and tables elsewhere.
+ *
+ * Control characters are the bytes 0x00 to 0x1f and 0x7f, HTAB, CR and LF
+ * included; the bytes 0x80 to 0xff (obs-text) are not.
+ *
+ * Example:
+ * size_t end = ByteScanner::findDelimiter(data, size, ' ');
+ * if (end < size && data[ end ] != ' ')
+ *     throw HttpStatusCodeException(BAD_REQUEST);
+ */
+
+#include <cstddef>
+
+class ByteScanner
+{
+private:
+    ByteScanner();
+
+public:
+    // First occurrence of byte
+    static size_t find(const char *data, size_t size, char byte);
+
+    // First occurrence of delimiter or of a control character
+    static size_t findDelimiter(const char *data, size_t size, char delimiter);
+
+    // First byte that is not a token character (RFC 9110, 5.6.2)
+    static size_t findNonToken(const char *data, size_t size);
+
+    // Name of the kernels in use: "avx2", "sse2" or "scalar"
+    static const char *getKernelName();
+};
+
+#endif // BYTESCANNER_HPP
+// Path: includes/utils/ByteScanner.hpp
@@ -14,6 +14,7 @@ public:
     ~SignalHandler();
 
     void sigint();
+    void sigpipe();
     void checkState();
 };
 